@@ -0,0 +1,210 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "avl.hpp"
+#include "key_prefix.hpp"
+#include "string_arena.hpp"
+
+/**
+ * @brief Mapa associativo com chaves de texto armazenadas em uma região
+ * compartilhada (`StringArena`).
+ *
+ * Equivale a um `Map<std::string, V>`, mas cada nó guarda apenas uma visão
+ * (ponteiro e tamanho) da chave, cujos bytes ficam em uma região somente de
+ * acréscimo do próprio mapa, e os primeiros bytes da chave (`KeyPrefix`).
+ * Isso elimina uma alocação e o cabeçalho de um `std::string` por nó, e a
+ * maioria das comparações na descida é decidida pelo prefixo, sem acessar a
+ * região. As buscas aceitam `std::string_view` e não alocam.
+ *
+ * Os bytes de chaves removidas só são devolvidos por `compact`.
+ *
+ * @tparam V Tipo do valor associado à chave.
+ */
+template <class V>
+class ArenaMap {
+ private:
+  /**
+   * @brief Par chave-valor armazenado em cada nó, ordenado pela chave.
+   */
+  struct Pair {
+    std::string_view key;                ///< Chave, armazenada na região.
+    KeyPrefix<std::string_view> prefix;  ///< Primeiros bytes da chave.
+    V value;                             ///< O valor associado.
+
+    explicit Pair(std::string_view k) : key(k), prefix(k), value() {}
+
+    bool operator<(const Pair& other) const {
+      if (!(prefix == other.prefix)) return prefix < other.prefix;
+      return key < other.key;
+    }
+  };
+
+  /**
+   * @brief Chave de busca com o prefixo já calculado.
+   */
+  struct Lookup {
+    std::string_view key;                ///< A chave procurada.
+    KeyPrefix<std::string_view> prefix;  ///< Prefixo de `key`.
+
+    explicit Lookup(std::string_view k) : key(k), prefix(k) {}
+
+    friend bool operator<(const Pair& pair, const Lookup& lookup) {
+      if (!(pair.prefix == lookup.prefix)) return pair.prefix < lookup.prefix;
+      return pair.key < lookup.key;
+    }
+
+    friend bool operator<(const Lookup& lookup, const Pair& pair) {
+      if (!(lookup.prefix == pair.prefix)) return lookup.prefix < pair.prefix;
+      return lookup.key < pair.key;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um mapa vazio.
+   */
+  ArenaMap();
+
+  /**
+   * @brief Copia os pares, armazenando as chaves em uma região própria.
+   */
+  ArenaMap(const ArenaMap& other);
+
+  ArenaMap(ArenaMap&& other) noexcept = default;
+  ArenaMap& operator=(ArenaMap other) noexcept;
+
+  /**
+   * @brief Acessa o valor associado a uma chave.
+   *
+   * Se a chave não existir, ela é copiada para a região e um par com o
+   * valor padrão de `V` é inserido.
+   *
+   * @param key A chave para buscar ou inserir.
+   * @return Uma referência ao valor associado à chave.
+   */
+  V& operator[](std::string_view key);
+
+  /**
+   * @brief Acessa o valor associado a uma chave (versão constante).
+   *
+   * @throw std::out_of_range se a chave não for encontrada.
+   */
+  const V& operator[](std::string_view key) const;
+
+  /**
+   * @brief Verifica se a chave está presente.
+   */
+  bool contain(std::string_view key) const;
+
+  /**
+   * @brief Remove um par chave-valor do mapa.
+   *
+   * @return `true` se a chave existia.
+   */
+  bool remove(std::string_view key);
+
+  /**
+   * @brief Retorna a quantidade de pares armazenados.
+   */
+  std::size_t size() const { return data.size(); }
+
+  /**
+   * @brief Retorna os pares em ordem crescente de chave.
+   *
+   * As chaves são visões válidas enquanto o mapa existir e até o próximo
+   * `compact`.
+   */
+  std::vector<std::pair<std::string_view, V>> in_order() const;
+
+  /**
+   * @brief Retorna os bytes ocupados na região, incluindo os de chaves já
+   * removidas.
+   */
+  std::size_t arena_bytes() const { return arena.bytes(); }
+
+  /**
+   * @brief Copia as chaves presentes para uma nova região e libera a antiga,
+   * devolvendo o espaço das chaves removidas.
+   *
+   * Invalida as visões de chaves obtidas anteriormente.
+   */
+  void compact();
+
+ private:
+  AVL<Pair> data;     ///< Pares ordenados pela chave.
+  StringArena arena;  ///< Bytes das chaves.
+};
+
+template <class V>
+ArenaMap<V>::ArenaMap() {}
+
+template <class V>
+ArenaMap<V>::ArenaMap(const ArenaMap& other) : ArenaMap() {
+  for (const Pair& pair : other.data.lazy_in_order()) {
+    (*this)[pair.key] = pair.value;
+  }
+}
+
+template <class V>
+ArenaMap<V>& ArenaMap<V>::operator=(ArenaMap other) noexcept {
+  std::swap(data, other.data);
+  std::swap(arena, other.arena);
+  return *this;
+}
+
+template <class V>
+V& ArenaMap<V>::operator[](std::string_view key) {
+  auto* node = data.find_node(Lookup(key));
+  if (node == nullptr) {
+    node = data.insert_or_find(Pair(arena.intern(key))).first;
+  }
+  return node->data.value;
+}
+
+template <class V>
+const V& ArenaMap<V>::operator[](std::string_view key) const {
+  const auto* node = data.find_node(Lookup(key));
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found in map");
+  }
+  return node->data.value;
+}
+
+template <class V>
+bool ArenaMap<V>::contain(std::string_view key) const {
+  return data.contain(Lookup(key));
+}
+
+template <class V>
+bool ArenaMap<V>::remove(std::string_view key) {
+  return data.remove(Lookup(key));
+}
+
+template <class V>
+std::vector<std::pair<std::string_view, V>> ArenaMap<V>::in_order() const {
+  std::vector<std::pair<std::string_view, V>> result;
+  result.reserve(size());
+  for (const Pair& pair : data.lazy_in_order()) {
+    result.emplace_back(pair.key, pair.value);
+  }
+  return result;
+}
+
+template <class V>
+void ArenaMap<V>::compact() {
+  StringArena fresh;
+  std::vector<std::string_view> keys;
+  keys.reserve(size());
+  for (const Pair& pair : data.lazy_in_order()) {
+    keys.push_back(pair.key);
+  }
+  // A nova cópia tem o mesmo conteúdo: a ordem da árvore não muda
+  for (std::string_view key : keys) {
+    data.find_node(Lookup(key))->data.key = fresh.intern(key);
+  }
+  arena = std::move(fresh);
+}
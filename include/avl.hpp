@@ -1,8 +1,42 @@
 #pragma once
 #include <algorithm> // Para std::max
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "generator.hpp"
+#include "scheduler.hpp"
+
+/**
+ * @brief Tipo `Q` que pode ser comparado diretamente com `T` pelo operador
+ * '<', nos dois sentidos.
+ */
+template <class Q, class T>
+concept LessComparableWith = requires(const T& t, const Q& q) {
+  { t < q } -> std::convertible_to<bool>;
+  { q < t } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Chave de outro tipo que pode ser usada nas buscas de uma árvore de
+ * `T` (por exemplo, `std::string_view` em uma árvore de `std::string`), sem
+ * construir um `T`.
+ */
+template <class Q, class T>
+concept HeterogeneousKey =
+    !std::same_as<std::remove_cvref_t<Q>, T> && LessComparableWith<Q, T>;
+
 /**
  * @brief Classe que representa uma Árvore Binária de Busca (BST).
  *
@@ -13,15 +47,17 @@
  */
 template <class T>
 class AVL {
- private:
+ public:
   /**
    * @brief Estrutura interna que representa um nó da árvore.
    */
   struct TreeNode {
-    T data;           ///< Valor armazenado no nó.
-    TreeNode* left;   ///< Ponteiro para o filho à esquerda.
-    TreeNode* right;  ///< Ponteiro para o filho à direita.
+    T data;              ///< Valor armazenado no nó.
+    TreeNode* child[2];  ///< Filhos: `child[0]` à esquerda e `child[1]` à
+                         ///< direita (o índice é `data < valor`).
     int height;  ///< Altura do nó na árvore. Usada para balanceamento da AVL.
+    bool removed;  ///< Marca de remoção preguiçosa (veja `remove_lazy`).
+    std::size_t size;  ///< Quantidade de nós não marcados na subárvore.
 
     /**
      * @brief Construtor que inicializa o nó com um valor.
@@ -50,6 +86,7 @@ class AVL {
     TreeNode* min();
   };
 
+ private:
   /**
    * @brief Retorna a altura de um nó da árvore.
    *
@@ -58,6 +95,21 @@ class AVL {
    */
   int height(TreeNode* node) const;
 
+  /**
+   * @brief Retorna a quantidade de nós da subárvore.
+   *
+   * @param node Ponteiro para o nó.
+   * @return Tamanho da subárvore, ou 0 caso seja nullptr.
+   */
+  std::size_t size(const TreeNode* node) const;
+
+  /**
+   * @brief Recalcula a altura e o tamanho de um nó a partir dos filhos.
+   *
+   * @param node Nó a ser atualizado (não nulo).
+   */
+  void update(TreeNode* node);
+
   /**
    * @brief Atualiza o balanceamento da árvore AVL a partir de um nó.
    *
@@ -69,38 +121,48 @@ class AVL {
    */
   void balance(TreeNode*& node);
 
-  // Funções de rotação
-  void rotate_left(TreeNode*& node);
-  void rotate_right(TreeNode*& node);
+  /**
+   * @brief Rotaciona a subárvore, promovendo o filho do lado `dir`.
+   *
+   * `rotate(node, 0)` é a rotação à direita e `rotate(node, 1)`, a rotação
+   * à esquerda; os dois casos espelhados compartilham o mesmo código.
+   *
+   * @param node Referência para o ponteiro da raiz da subárvore.
+   * @param dir Lado do filho que sobe (0 = esquerda, 1 = direita).
+   */
+  void rotate(TreeNode*& node, int dir);
 
   /**
    * @brief Insere um valor na árvore recursivamente.
    *
    * @param node Ponteiro de referência para o nó atual.
    * @param value Valor a ser inserido.
+   * @param found Recebe o nó inserido ou o nó que já continha o valor.
    * @return `true` se a inserção foi bem-sucedida, `false` se o valor já
    * existia.
    */
-  bool insert(TreeNode*& node, const T& value);
+  bool insert(TreeNode*& node, const T& value, TreeNode*& found);
 
   /**
    * @brief Remove um valor da árvore recursivamente.
    *
    * @param node Ponteiro de referência para o nó atual.
-   * @param value Valor a ser removido.
+   * @param value Valor (ou chave heterogênea) a ser removido.
    * @return `true` se a remoção foi bem-sucedida, `false` se o valor não foi
    * encontrado.
    */
-  bool remove(TreeNode*& node, const T& value);
+  template <class Q>
+  bool remove(TreeNode*& node, const Q& value);
 
   /**
    * @brief Verifica se a árvore contém um valor específico.
    *
    * @param node Ponteiro para o nó atual.
-   * @param value Valor a ser buscado.
+   * @param value Valor (ou chave heterogênea) a ser buscado.
    * @return `true` se o valor estiver na árvore, `false` caso contrário.
    */
-  bool contain(const TreeNode* const node, const T& value) const;
+  template <class Q>
+  bool contain(const TreeNode* const node, const Q& value) const;
 
   /**
    * @brief Executa a travessia in-order recursiva.
@@ -135,12 +197,271 @@ class AVL {
    */
   void post_order(const TreeNode* const node, std::vector<T>& result) const;
 
+  /**
+   * @brief Copia a subárvore em ordem para `out`, em paralelo.
+   *
+   * O tamanho da subárvore esquerda determina a posição do nó atual em `out`,
+   * de forma que as duas subárvores são copiadas de maneira independente.
+   *
+   * @param node Ponteiro para o nó atual.
+   * @param out Região de saída com exatamente `size(node)` posições.
+   * @param project Função aplicada a cada valor antes de ser copiado.
+   */
+  template <class U, class Projection>
+  void parallel_in_order(const TreeNode* const node, std::span<U> out,
+                         const Projection& project) const;
+
+  /**
+   * @brief Busca sem desvios condicionais para chaves aritméticas.
+   *
+   * O filho seguinte é escolhido pelo índice `data < value` em vez de um
+   * `if`: a descida vira uma cadeia de leituras dependentes, sem os erros de
+   * previsão de desvio que dominam a busca quando as chaves são aleatórias.
+   * Só a igualdade encerra o laço mais cedo.
+   *
+   * @param node Raiz da subárvore.
+   * @param value O valor procurado.
+   * @return O nó com o valor, ou nullptr.
+   */
+  template <class Node>
+  static Node* branchless_find(Node* node, const T& value) {
+    while (node != nullptr) {
+      bool greater = node->data < value;
+      if (!greater && !(value < node->data)) break;
+      node = node->child[greater];
+    }
+    return node;
+  }
+
+  template <class Q>
+  TreeNode* find_node(TreeNode* node, const Q& value) const {
+    if constexpr (std::is_arithmetic_v<T> && std::same_as<Q, T>) {
+      node = branchless_find(node, value);
+      return node != nullptr && !node->removed ? node : nullptr;
+    } else {
+      if (node == nullptr) {
+        return nullptr;
+      }
+
+      if (value < node->data) {
+        return find_node(node->child[0], value);
+      } else if (node->data < value) {
+        return find_node(node->child[1], value);
+      } else {
+        return node->removed ? nullptr : node;
+      }
+    }
+  }
+
+  /**
+   * @brief Visita recursivamente a subárvore, dividindo o trabalho entre
+   * as threads do escalonador.
+   *
+   * @param node Ponteiro para o nó atual.
+   * @param visit Função chamada para cada valor.
+   */
+  template <class Visitor>
+  void parallel_for_each(const TreeNode* const node,
+                         const Visitor& visit) const;
+
+  /**
+   * @brief Reduz recursivamente a subárvore, combinando os resultados das
+   * subárvores esquerda e direita com o valor do nó, nesta ordem.
+   */
+  template <class R, class Mapper, class Reducer>
+  R parallel_reduce(const TreeNode* const node, const R& identity,
+                    const Mapper& mapper, const Reducer& reducer) const;
+
+  /**
+   * @brief Constrói uma nova subárvore balanceada com as cópias dos valores
+   * que satisfazem `pred`, unindo os resultados das subárvores com `join`.
+   *
+   * @param node Nó da árvore de origem (pode pertencer a outra árvore).
+   * @return Raiz da nova subárvore.
+   */
+  template <class Predicate>
+  TreeNode* filter(const TreeNode* const node, const Predicate& pred);
+
+  /**
+   * @brief Une duas subárvores e um nó intermediário em uma árvore AVL.
+   *
+   * Todos os valores de `left` devem ser menores que `mid->data` e todos os de
+   * `right`, maiores. Desce pela espinha da subárvore mais alta até encontrar
+   * uma subárvore de altura compatível com a outra e rebalanceia na volta.
+   * Custa O(|altura(left) - altura(right)| + 1).
+   *
+   * @param left Subárvore com os valores menores.
+   * @param mid Nó (já alocado) que ficará entre as duas subárvores.
+   * @param right Subárvore com os valores maiores.
+   * @return Raiz da árvore resultante.
+   */
+  TreeNode* join(TreeNode* left, TreeNode* mid, TreeNode* right);
+
+  /**
+   * @brief Concatena duas subárvores sem nó intermediário.
+   *
+   * Todos os valores de `left` devem ser menores que os de `right`.
+   *
+   * @return Raiz da árvore resultante.
+   */
+  TreeNode* join(TreeNode* left, TreeNode* right);
+
+  /**
+   * @brief Desconecta o nó mínimo da subárvore, rebalanceando o caminho.
+   *
+   * @param node Referência para a raiz da subárvore (não nula).
+   * @return O nó mínimo, já sem filhos.
+   */
+  TreeNode* extract_min(TreeNode*& node);
+
+  /**
+   * @brief Copia recursivamente uma subárvore, preservando seu formato.
+   *
+   * @return Raiz da cópia.
+   */
+  static TreeNode* clone(const TreeNode* const node);
+
+  /**
+   * @brief Constrói uma subárvore perfeitamente balanceada a partir de
+   * valores ordenados e distintos.
+   *
+   * @param values Ponteiro para o primeiro valor.
+   * @param count Quantidade de valores.
+   * @return Raiz da nova subárvore.
+   */
+  TreeNode* build(const T* values, std::size_t count);
+
+  /**
+   * @brief Religa nós já existentes, em ordem, em uma subárvore
+   * perfeitamente balanceada, sem alocar.
+   *
+   * @param nodes Ponteiro para o primeiro nó (sem filhos).
+   * @param count Quantidade de nós.
+   * @return Raiz da nova subárvore.
+   */
+  TreeNode* relink(TreeNode* const* nodes, std::size_t count);
+
+  /**
+   * @brief Marca como removido o nó equivalente a `value`, descontando-o do
+   * tamanho das subárvores no caminho.
+   *
+   * @return `true` se havia um nó não marcado com o valor.
+   */
+  template <class Q>
+  bool remove_lazy(TreeNode* node, const Q& value);
+
+  /**
+   * @brief Conta os valores da subárvore menores que `value`.
+   */
+  template <class Q>
+  std::size_t rank(const TreeNode* node, const Q& value) const;
+
+  /**
+   * @brief Substitui um nó marcado por `remove_lazy` por um novo nó, sem
+   * filhos, na mesma posição.
+   *
+   * O valor é copiado para um nó novo, como em qualquer inserção, em vez de
+   * atribuído ao nó marcado: `T` não precisa ser atribuível por cópia.
+   */
+  void revive(TreeNode*& node, TreeNode* fresh);
+
+  /**
+   * @brief Chama `purge` quando as marcas superam os valores presentes.
+   */
+  void purge_if_sparse() {
+    if (dead > size()) purge();
+  }
+
+  /**
+   * @brief Divide a subárvore em valores menores e maiores que `value`.
+   *
+   * A subárvore original é consumida: seus nós são redistribuídos entre
+   * `left`, `right` e o nó retornado. Custa O(log n).
+   *
+   * @param node Raiz da subárvore a ser dividida.
+   * @param value Valor de corte.
+   * @param left Recebe a subárvore com os valores menores que `value`.
+   * @param right Recebe a subárvore com os valores maiores que `value`.
+   * @return O nó (desconectado) com valor equivalente a `value`, ou nullptr.
+   */
+  TreeNode* split(TreeNode* node, const T& value, TreeNode*& left,
+                  TreeNode*& right);
+
+  /**
+   * @brief União de duas subárvores por divisão e junção.
+   *
+   * Divide `tree` pelo valor da raiz de `batch`, une recursivamente as
+   * metades (em paralelo) e as junta novamente. Quando um valor existe nas
+   * duas, o nó de `tree` é mantido, recebe `merge(existente, do_lote)` e o
+   * nó de `batch` é liberado. Custa O(m log(n/m + 1)), com m o tamanho da
+   * menor.
+   *
+   * @return Raiz da subárvore resultante.
+   */
+  template <class Merge>
+  TreeNode* unite(TreeNode* tree, TreeNode* batch, const Merge& merge);
+
+  /**
+   * @brief Remove de `tree` os valores ordenados de `values`, por divisão e
+   * junção.
+   *
+   * @return Raiz da subárvore resultante.
+   */
+  TreeNode* difference(TreeNode* tree, const T* values, std::size_t count);
+
+  /**
+   * @brief Copia os valores de um intervalo, ordena e descarta os
+   * equivalentes, mantendo a primeira ocorrência de cada um.
+   */
+  template <class Range>
+  static std::vector<T> sorted_unique(const Range& values);
+
+  /**
+   * @brief Coleta até `k` valores a partir de um dos extremos da árvore.
+   *
+   * @tparam Descending Se verdadeiro, parte do máximo em ordem decrescente;
+   * caso contrário, parte do mínimo em ordem crescente.
+   */
+  template <bool Descending>
+  std::vector<T> extremes(std::size_t k) const;
+
+  /**
+   * @brief Gerador pseudoaleatório padrão das amostragens, um por thread.
+   */
+  static std::mt19937_64& random_engine();
+
+  /**
+   * @brief Executa `left` e `right` com `Scheduler::global().fork_join` se
+   * `work` (quantidade de nós envolvidos) for grande o suficiente, ou
+   * sequencialmente caso contrário.
+   */
+  template <class Left, class Right>
+  static void fork(std::size_t work, const Left& left, const Right& right);
+
+  /// Subárvores menores que isto são processadas sem bifurcar tarefas.
+  static constexpr std::size_t parallel_grain = 1 << 12;
+
  public:
   /**
    * @brief Construtor da árvore (inicialmente vazia).
    */
   AVL();
 
+  /**
+   * @brief Construtor de cópia. Copia todos os nós, preservando o formato.
+   */
+  AVL(const AVL& other);
+
+  /**
+   * @brief Construtor de movimento. `other` fica vazia.
+   */
+  AVL(AVL&& other) noexcept;
+
+  /**
+   * @brief Atribuição por cópia ou movimento.
+   */
+  AVL& operator=(AVL other) noexcept;
+
   /**
    * @brief Destrutor da árvore, libera todos os nós.
    */
@@ -154,14 +475,93 @@ class AVL {
    */
   bool insert(const T& value);
 
+  /**
+   * @brief Insere um novo valor em uma única descida, sem recursão.
+   *
+   * Na descida guarda o caminho e o ancestral mais profundo com subárvores
+   * de alturas diferentes (o nó crítico). Só os nós abaixo dele mudam de
+   * altura, e uma eventual rotação acontece nele, sem alterar a altura da
+   * sua subárvore: os nós acima não são rebalanceados, ao contrário de
+   * `insert`, que chama `balance` em todos os níveis na volta, e os
+   * tamanhos do caminho são ajustados sem novas comparações. Como apenas a
+   * subárvore do nó crítico muda de formato, uma variante concorrente
+   * poderia bloquear somente ela.
+   *
+   * O resultado é o mesmo de `insert`. A árvore só é alterada depois da
+   * descida, então uma exceção na cópia de `value` ou em uma comparação a
+   * deixa intacta.
+   *
+   * @param value Valor a ser inserido.
+   * @return `true` se inserido com sucesso, `false` se o valor já existia.
+   */
+  bool insert_top_down(const T& value);
+
   /**
    * @brief Remove um valor da árvore.
    *
+   * Apenas o nó do valor removido é liberado; os demais nós (e os valores
+   * neles armazenados) mantêm o endereço.
+   *
    * @param value Valor a ser removido.
    * @return `true` se o valor foi removido, `false` se não estava presente.
    */
   bool remove(const T& value);
 
+  /**
+   * @brief Remove o valor equivalente a uma chave de outro tipo, sem
+   * construir um `T`.
+   *
+   * @param key Chave comparável com `T`.
+   * @return `true` se o valor foi removido, `false` se não estava presente.
+   */
+  template <HeterogeneousKey<T> Q>
+  bool remove(const Q& key) {
+    bool removed = remove(root, key);
+    purge_if_sparse();
+    return removed;
+  }
+
+  /**
+   * @brief Remove um valor apenas marcando o seu nó (tombstone).
+   *
+   * Custa uma descida, sem rotações: o nó continua na árvore, mas deixa de
+   * ser encontrado pelas buscas, contado em `size`, `select` e `rank` e
+   * visitado pelas travessias. Reinserir o valor ocupa a posição do nó.
+   * Quando as marcas passam a ser mais numerosas que os valores presentes
+   * (verificado também após `remove`), `purge` reconstrói a árvore; assim
+   * uma rajada de remoções custa O(k log n) mais uma reconstrução linear, em
+   * vez de uma cascata de rotações por chave.
+   *
+   * @param value Valor a ser removido.
+   * @return `true` se o valor foi removido, `false` se não estava presente.
+   */
+  bool remove_lazy(const T& value) { return remove_lazy(root, value); }
+
+  /**
+   * @brief Marca como removido o valor equivalente a uma chave de outro
+   * tipo, sem construir um `T`.
+   */
+  template <HeterogeneousKey<T> Q>
+  bool remove_lazy(const Q& key) {
+    return remove_lazy(root, key);
+  }
+
+  /**
+   * @brief Libera os nós marcados por `remove_lazy` e reconstrói a árvore
+   * perfeitamente balanceada com os nós restantes, em O(n).
+   *
+   * Os nós restantes mantêm o endereço. Também é chamada no início das
+   * operações em lote (`insert_batch`, `remove_batch`, `apply_batch`), cuja
+   * divisão e junção supõem uma árvore sem marcas.
+   */
+  void purge();
+
+  /**
+   * @brief Retorna a quantidade de nós marcados por `remove_lazy` que
+   * ainda não foram liberados.
+   */
+  std::size_t tombstones() const { return dead; }
+
   /**
    * @brief Verifica se um valor está presente na árvore.
    *
@@ -170,6 +570,17 @@ class AVL {
    */
   bool contain(const T& value) const;
 
+  /**
+   * @brief Verifica se há um valor equivalente a uma chave de outro tipo,
+   * sem construir um `T`.
+   *
+   * @param key Chave comparável com `T`.
+   */
+  template <HeterogeneousKey<T> Q>
+  bool contain(const Q& key) const {
+    return contain(root, key);
+  }
+
   /**
    * @brief Retorna os valores da árvore em ordem (in-order).
    *
@@ -198,82 +609,560 @@ class AVL {
   std::vector<T> post_order() const;
 
   /**
-   * @brief Verifica se a árvore está balanceada (propriedade da AVL).
+   * @brief Retorna os `k` menores valores, em ordem crescente.
    *
-   * @return `true` se todos os nós estão balanceados, `false` caso contrário.
+   * Desce até o mínimo e avança pelo sucessor, sem percorrer o restante da
+   * árvore: O(k + log n).
+   *
+   * @param k Quantidade de valores desejados.
+   * @return Os `min(k, size())` menores valores.
    */
-  bool is_balanced() const { return is_balanced(root).first; }
+  std::vector<T> bottom_k(std::size_t k) const { return extremes<false>(k); }
 
   /**
-   * @brief Verifica recursivamente se a subárvore está balanceada e retorna sua
-   * altura.
+   * @brief Retorna os `k` maiores valores, em ordem decrescente.
    *
-   * @param node Nó atual.
-   * @return Par (está_balanceada, altura).
+   * Desce até o máximo e avança pelo antecessor: O(k + log n).
+   *
+   * @param k Quantidade de valores desejados.
+   * @return Os `min(k, size())` maiores valores.
    */
-  std::pair<bool, int> is_balanced(TreeNode* node) const {
-    if (!node) return {true, -1};
+  std::vector<T> top_k(std::size_t k) const { return extremes<true>(k); }
 
-    auto left = is_balanced(node->left);
-    auto right = is_balanced(node->right);
+  /**
+   * @brief Seleciona os `k` valores que vêm primeiro segundo um critério
+   * diferente da ordem da árvore, mantendo um heap limitado a `k`
+   * elementos: O(n log k).
+   *
+   * @param k Quantidade de valores desejados.
+   * @param before Função `bool(const T&, const T&)` que diz se o primeiro
+   * valor vem antes do segundo no resultado.
+   * @return Ponteiros para os `min(k, size())` valores selecionados, na
+   * ordem de `before`. Valem até a próxima alteração da árvore.
+   */
+  template <class Before>
+  std::vector<const T*> select_k(std::size_t k, Before before) const;
 
-    bool balanced =
-        left.first && right.first && std::abs(left.second - right.second) <= 1;
-    int node_height = 1 + std::max(left.second, right.second);
+  /**
+   * @brief Retorna o valor de posição `rank` na ordem crescente.
+   *
+   * Usa o tamanho das subárvores para descer diretamente até o valor:
+   * O(log n).
+   *
+   * @param rank Posição (a partir de 0) do valor desejado.
+   * @return Referência ao valor.
+   * @throw std::out_of_range se `rank >= size()`.
+   */
+  const T& select(std::size_t rank) const;
 
-    return {balanced, node_height};
-  }
+  /**
+   * @brief Retorna a quantidade de valores estritamente menores que `value`.
+   *
+   * É a posição que `value` ocupa (ou ocuparia) na ordem crescente: O(log n).
+   *
+   * @param value Valor de referência (não precisa estar na árvore).
+   * @return Número de valores menores que `value`.
+   */
+  std::size_t rank(const T& value) const { return rank(root, value); }
 
- private:
-  TreeNode* root;  ///< Ponteiro para a raiz da árvore.
-};
+  /**
+   * @brief Retorna a quantidade de valores menores que uma chave de outro
+   * tipo, sem construir um `T`.
+   */
+  template <HeterogeneousKey<T> Q>
+  std::size_t rank(const Q& key) const {
+    return rank(root, key);
+  }
 
-// Implementações de TreeNode
-template <class T>
-AVL<T>::TreeNode::TreeNode(const T& value)
-    : data(value), left(nullptr), right(nullptr), height(0) {}
+  /**
+   * @brief Retorna um valor escolhido uniformemente ao acaso, em O(log n).
+   *
+   * @param gen Gerador de bits aleatórios.
+   * @return Cópia do valor sorteado.
+   * @throw std::out_of_range se a árvore estiver vazia.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  T sample(URBG& gen) const;
 
-template <class T>
-AVL<T>::TreeNode::~TreeNode() {
-  delete left;
-  delete right;
-}
+  /**
+   * @brief Sorteia `k` valores distintos uniformemente, sem reposição.
+   *
+   * As posições são sorteadas pelo algoritmo de Floyd e cada valor é obtido
+   * com `select`: O(k log n), sem percorrer a árvore.
+   *
+   * @param k Quantidade de valores; se for maior que `size()`, todos os
+   * valores são retornados.
+   * @param gen Gerador de bits aleatórios.
+   * @return Os valores sorteados, em ordem crescente.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  std::vector<T> sample(std::size_t k, URBG& gen) const;
 
-template <class T>
-typename AVL<T>::TreeNode* AVL<T>::TreeNode::max() {
-  return right ? right->max() : this;
-}
+  /**
+   * @brief Versão de `sample(gen)` que usa um gerador interno por thread.
+   */
+  T sample() const { return sample(random_engine()); }
 
-template <class T>
-typename AVL<T>::TreeNode* AVL<T>::TreeNode::min() {
-  return left ? left->min() : this;
-}
+  /**
+   * @brief Versão de `sample(k, gen)` que usa um gerador interno por thread.
+   */
+  std::vector<T> sample(std::size_t k) const {
+    return sample(k, random_engine());
+  }
 
-// Implementações de AVL (Construtor e Destrutor)
-template <class T>
-AVL<T>::AVL() : root(nullptr) {}
+  /**
+   * @brief Retorna a quantidade de elementos na árvore.
+   *
+   * @return Número de elementos, em O(1).
+   */
+  std::size_t size() const { return size(root); }
 
-template <class T>
-AVL<T>::~AVL() {
-  delete root;
-}
+  /**
+   * @brief Copia os valores em ordem para um vetor pré-alocado, em paralelo.
+   *
+   * Como cada nó conhece o tamanho de sua subárvore, a posição de saída de
+   * cada subárvore é conhecida de antemão e as subárvores grandes são
+   * copiadas simultaneamente em várias threads.
+   *
+   * @param out Região de saída com pelo menos `size()` posições. Apenas as
+   * primeiras `size()` posições são escritas.
+   * @throw std::out_of_range se `out` for menor que a árvore.
+   */
+  void parallel_in_order(std::span<T> out) const {
+    parallel_in_order(out, [](const T& value) -> const T& { return value; });
+  }
 
-// Implementações de AVL (Funções Públicas)
-template <class T>
-bool AVL<T>::insert(const T& value) {
-  return insert(root, value);
-}
+  /**
+   * @brief Versão de `parallel_in_order` que converte cada valor.
+   *
+   * @param out Região de saída com pelo menos `size()` posições.
+   * @param project Função aplicada a cada valor; seu resultado é atribuído à
+   * posição correspondente de `out`. Deve ser segura para uso concorrente.
+   * @throw std::out_of_range se `out` for menor que a árvore.
+   */
+  template <class U, class Projection>
+  void parallel_in_order(std::span<U> out, Projection project) const;
 
-template <class T>
-bool AVL<T>::remove(const T& value) {
-  return remove(root, value);
-}
+  /**
+   * @brief Aplica `visit` a todos os valores, em paralelo.
+   *
+   * A árvore é dividida em subárvores que são visitadas em threads distintas;
+   * a ordem das chamadas não é especificada.
+   *
+   * @param visit Função `void(const T&)`. Deve ser segura para uso
+   * concorrente.
+   */
+  template <class Visitor>
+  void parallel_for_each(Visitor visit) const;
 
-template <class T>
+  /**
+   * @brief Calcula, em paralelo, a redução dos valores transformados.
+   *
+   * Equivale a `reducer(...reducer(identity, mapper(v1))..., mapper(vn))`
+   * com os valores em ordem, mas agrupa as operações por subárvore.
+   *
+   * @param identity Elemento neutro de `reducer`.
+   * @param mapper Função `R(const T&)` aplicada a cada valor.
+   * @param reducer Função `R(R, R)` associativa.
+   * @return Resultado da redução, ou `identity` se a árvore estiver vazia.
+   */
+  template <class R, class Mapper, class Reducer>
+  R parallel_reduce(R identity, Mapper mapper, Reducer reducer) const;
+
+  /**
+   * @brief Retorna uma nova árvore com os valores que satisfazem `pred`.
+   *
+   * As subárvores são filtradas em paralelo e os resultados são unidos
+   * com `join`, de modo que a árvore resultante já nasce balanceada, sem
+   * reinserções. Custa O(n) trabalho.
+   *
+   * @param pred Predicado `bool(const T&)`. Deve ser seguro para uso
+   * concorrente.
+   * @return Árvore com as cópias dos valores selecionados.
+   */
+  template <class Predicate>
+  AVL filter(Predicate pred) const;
+
+  /**
+   * @brief Insere todos os valores de um intervalo de uma só vez.
+   *
+   * O lote é ordenado e transformado em uma árvore balanceada, que é unida
+   * à árvore atual por divisão e junção. Assim, os níveis superiores são
+   * percorridos uma vez por lote, e não uma vez por valor, e as partes
+   * independentes são processadas em paralelo. Valores já presentes (ou
+   * repetidos no lote) são ignorados, como em `insert`.
+   *
+   * @param values Intervalo (`std::ranges::input_range`) de valores.
+   * @return Quantidade de valores efetivamente inseridos.
+   */
+  template <class Range>
+  std::size_t insert_batch(const Range& values);
+
+  /**
+   * @brief Remove todos os valores de um intervalo de uma só vez.
+   *
+   * O lote é ordenado e a árvore é dividida pelos valores do lote e
+   * reconstruída por junções, em paralelo, sem uma descida por valor.
+   *
+   * @param values Intervalo (`std::ranges::input_range`) de valores.
+   * @return Quantidade de valores efetivamente removidos.
+   */
+  template <class Range>
+  std::size_t remove_batch(const Range& values);
+
+  /**
+   * @brief Insere um lote de valores, combinando os que já existem.
+   *
+   * Funciona como `insert_batch(values)`, mas quando um valor do lote já
+   * está na árvore chama `merge(existente, do_lote)`, que pode alterar o
+   * valor existente (sem mudar sua posição na ordem). Repetições dentro do
+   * próprio lote não são combinadas: vale a primeira ocorrência.
+   *
+   * Se `merge` lançar uma exceção, a árvore continua válida e as demais
+   * combinações são aplicadas; a primeira exceção é relançada ao final.
+   *
+   * @param values Intervalo de valores.
+   * @param merge Função `void(T&, const T&)`. Pode ser chamada em paralelo
+   * para valores distintos.
+   * @return Quantidade de valores novos inseridos.
+   */
+  template <class Range, class Merge>
+  std::size_t insert_batch(const Range& values, Merge merge);
+
+  /**
+   * @brief Remove e insere lotes de valores em uma única passada.
+   *
+   * Primeiro retira os valores de `removes` e depois une os de `inserts`,
+   * de modo que um valor presente nos dois lotes é substituído pela versão
+   * de `inserts`. Todas as alocações acontecem antes de a árvore ser
+   * alterada: se alguma falhar, a árvore permanece intacta (desde que as
+   * comparações não lancem exceções).
+   *
+   * @param inserts Intervalo de valores a inserir.
+   * @param removes Intervalo de valores a remover.
+   */
+  template <class InsertRange, class RemoveRange>
+  void apply_batch(const InsertRange& inserts, const RemoveRange& removes);
+
+  /**
+   * @brief Percorre a árvore em ordem (in-order) de forma preguiçosa.
+   *
+   * Os valores são produzidos um a um, sem construir o vetor completo, o que
+   * permite interromper a travessia antecipadamente ou encadeá-la com views
+   * de `std::ranges`. A árvore não deve ser modificada enquanto o gerador
+   * estiver em uso.
+   *
+   * @return Gerador com os valores em ordem.
+   */
+  Generator<T> lazy_in_order() const;
+
+  /**
+   * @brief Percorre em ordem, de forma preguiçosa, os valores do intervalo
+   * [first, last).
+   *
+   * A descida até `first` custa O(log n), e cada valor seguinte O(1)
+   * amortizado. Os limites são recebidos por valor, pois a corrotina pode
+   * sobreviver aos temporários passados como argumento.
+   *
+   * @param first Limite inferior (inclusivo).
+   * @param last Limite superior (exclusivo).
+   * @return Gerador com os valores do intervalo em ordem.
+   */
+  Generator<T> lazy_range(T first, T last) const;
+
+  /**
+   * @brief Percorre a árvore em pré-ordem (pre-order) de forma preguiçosa.
+   *
+   * Útil para serializar apenas um prefixo da árvore: somente os nós
+   * efetivamente consumidos são visitados.
+   *
+   * @return Gerador com os valores em pré-ordem.
+   */
+  Generator<T> lazy_pre_order() const;
+
+  /**
+   * @brief Percorre a árvore em pós-ordem (post-order) de forma preguiçosa.
+   *
+   * @return Gerador com os valores em pós-ordem.
+   */
+  Generator<T> lazy_post_order() const;
+
+  /**
+   * @brief Retorna os valores da árvore em ordem de nível (busca em largura).
+   *
+   * Visita a raiz, depois todos os nós do nível 1 da esquerda para a direita,
+   * e assim por diante. Reinserir os valores nesta ordem em uma árvore vazia
+   * reproduz o mesmo formato, sem necessidade de rebalanceamento.
+   *
+   * @return Vetor com os valores em ordem de nível.
+   */
+  std::vector<T> level_order() const;
+
+  /**
+   * @brief Visita os valores da árvore em ordem de nível.
+   *
+   * @param visit Função `void(const T&)` chamada para cada valor.
+   */
+  template <class Visitor>
+  void level_order(Visitor visit) const;
+
+  /**
+   * @brief Percorre a árvore em ordem de nível de forma preguiçosa.
+   *
+   * A memória extra é proporcional à largura do nível mais largo já
+   * alcançado. A árvore não deve ser modificada enquanto o gerador estiver
+   * em uso.
+   *
+   * @return Gerador com os valores em ordem de nível.
+   */
+  Generator<T> lazy_level_order() const;
+
+  /**
+   * @brief Verifica se a árvore está balanceada (propriedade da AVL).
+   *
+   * @return `true` se todos os nós estão balanceados, `false` caso contrário.
+   */
+  bool is_balanced() const { return is_balanced(root).first; }
+
+  /**
+   * @brief Insere o valor, caso ainda não exista, e retorna o nó que o
+   * contém, em uma única descida.
+   *
+   * @param value Valor a ser inserido.
+   * @return Par com o nó do valor (novo ou existente) e `true` se o valor foi
+   * inserido.
+   */
+  std::pair<TreeNode*, bool> insert_or_find(const T& value);
+
+  /**
+   * @brief Retorna o ponteiro para o nodo contendo o valor.
+   *
+   * @return Ponteiro para o nodo ou nullptr se o valor não estiver na árvore.
+   */
+  TreeNode* find_node(const T& value) const { return find_node(root, value); }
+
+  /**
+   * @brief Retorna o nodo com o valor equivalente a uma chave de outro tipo,
+   * sem construir um `T`.
+   *
+   * @return Ponteiro para o nodo ou nullptr se não houver valor equivalente.
+   */
+  template <HeterogeneousKey<T> Q>
+  TreeNode* find_node(const Q& key) const {
+    return find_node(root, key);
+  }
+
+  /**
+   * @brief Verifica recursivamente se a subárvore está balanceada e retorna sua
+   * altura.
+   *
+   * @param node Nó atual.
+   * @return Par (está_balanceada, altura).
+   */
+  std::pair<bool, int> is_balanced(TreeNode* node) const {
+    if (!node) return {true, -1};
+
+    auto left = is_balanced(node->child[0]);
+    auto right = is_balanced(node->child[1]);
+
+    bool balanced =
+        left.first && right.first && std::abs(left.second - right.second) <= 1;
+    int node_height = 1 + std::max(left.second, right.second);
+
+    return {balanced, node_height};
+  }
+
+ private:
+  TreeNode* root;    ///< Ponteiro para a raiz da árvore.
+  std::size_t dead;  ///< Nós marcados por `remove_lazy` ainda na árvore.
+};
+
+// Implementações de TreeNode
+template <class T>
+AVL<T>::TreeNode::TreeNode(const T& value)
+    : data(value),
+      child{nullptr, nullptr},
+      height(0),
+      removed(false),
+      size(1) {}
+
+template <class T>
+AVL<T>::TreeNode::~TreeNode() {
+  delete child[0];
+  delete child[1];
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::TreeNode::max() {
+  return child[1] ? child[1]->max() : this;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::TreeNode::min() {
+  return child[0] ? child[0]->min() : this;
+}
+
+// Implementações de AVL (Construtor e Destrutor)
+template <class T>
+AVL<T>::AVL() : root(nullptr), dead(0) {}
+
+template <class T>
+AVL<T>::AVL(const AVL& other) : root(clone(other.root)), dead(other.dead) {}
+
+template <class T>
+AVL<T>::AVL(AVL&& other) noexcept : root(other.root), dead(other.dead) {
+  other.root = nullptr;
+  other.dead = 0;
+}
+
+template <class T>
+AVL<T>& AVL<T>::operator=(AVL other) noexcept {
+  std::swap(root, other.root);
+  std::swap(dead, other.dead);
+  return *this;
+}
+
+template <class T>
+AVL<T>::~AVL() {
+  delete root;
+}
+
+// Implementações de AVL (Funções Públicas)
+template <class T>
+bool AVL<T>::insert(const T& value) {
+  TreeNode* found;
+  return insert(root, value, found);
+}
+
+template <class T>
+std::pair<typename AVL<T>::TreeNode*, bool> AVL<T>::insert_or_find(
+    const T& value) {
+  TreeNode* found;
+  bool inserted = insert(root, value, found);
+  return {found, inserted};
+}
+
+template <class T>
+bool AVL<T>::insert_top_down(const T& value) {
+  // Uma AVL com menos de 2^64 nós tem altura menor que 92
+  constexpr int max_depth = 96;
+  TreeNode* path[max_depth];
+  int depth = 0;
+  int critical = 0;  // Posição do nó crítico em `path`
+  TreeNode** critical_link = &root;
+
+  // O nó é criado antes da descida, e a descida não altera a árvore: se a
+  // cópia de `value` ou uma comparação lançar exceção, nada muda
+  TreeNode* leaf = new TreeNode(value);
+  TreeNode** link = &root;
+  try {
+    while (TreeNode* node = *link) {
+      bool greater = node->data < value;
+      if (!greater && !(value < node->data)) break;
+      if (height(node->child[0]) != height(node->child[1])) {
+        critical = depth;
+        critical_link = link;
+      }
+      path[depth++] = node;
+      link = &node->child[greater];
+    }
+  } catch (...) {
+    delete leaf;
+    throw;
+  }
+
+  if (*link != nullptr && !(*link)->removed) {
+    delete leaf;  // Duplicado
+    return false;
+  }
+  for (int i = 0; i < depth; ++i) {
+    ++path[i]->size;
+  }
+  if (*link != nullptr) {
+    // Ocupa a posição do nó marcado; a altura não muda
+    revive(*link, leaf);
+    return true;
+  }
+  *link = leaf;
+  if (depth == 0) return true;
+
+  // Os nós entre o crítico e a folha estavam equilibrados e crescem um nível
+  for (int i = critical + 1; i < depth; ++i) {
+    ++path[i]->height;
+  }
+  balance(*critical_link);
+  return true;
+}
+
+template <class T>
+bool AVL<T>::remove(const T& value) {
+  bool removed = remove(root, value);
+  purge_if_sparse();
+  return removed;
+}
+
+template <class T>
 bool AVL<T>::contain(const T& value) const {
   return contain(root, value);
 }
 
+template <class T>
+template <class Q>
+bool AVL<T>::remove_lazy(TreeNode* node, const Q& value) {
+  TreeNode* target = find_node(node, value);
+  if (target == nullptr) return false;
+  for (; node != target; node = node->child[node->data < value]) {
+    --node->size;
+  }
+  target->removed = true;
+  --target->size;
+  ++dead;
+  purge_if_sparse();
+  return true;
+}
+
+template <class T>
+void AVL<T>::revive(TreeNode*& node, TreeNode* fresh) {
+  fresh->child[0] = std::exchange(node->child[0], nullptr);
+  fresh->child[1] = std::exchange(node->child[1], nullptr);
+  fresh->height = node->height;
+  update(fresh);
+  delete node;
+  node = fresh;
+  --dead;
+}
+
+template <class T>
+void AVL<T>::purge() {
+  if (dead == 0) return;
+  // Reserva tudo antes de desmontar a árvore, que não pode falhar no meio
+  std::vector<TreeNode*> live;
+  live.reserve(size());
+  std::vector<TreeNode*> stack;
+  stack.reserve(root->height + 1);
+
+  TreeNode* node = root;
+  while (node != nullptr || !stack.empty()) {
+    while (node != nullptr) {
+      stack.push_back(node);
+      node = node->child[0];
+    }
+    node = stack.back();
+    stack.pop_back();
+    // A subárvore esquerda já foi visitada: o nó pode ser desligado
+    TreeNode* next = node->child[1];
+    node->child[0] = node->child[1] = nullptr;
+    if (node->removed) {
+      delete node;
+    } else {
+      live.push_back(node);
+    }
+    node = next;
+  }
+  root = relink(live.data(), live.size());
+  dead = 0;
+}
+
 // Implementações de AVL (Funções Privadas de Balanceamento)
 template <class T>
 int AVL<T>::height(TreeNode* node) const {
@@ -281,22 +1170,24 @@ int AVL<T>::height(TreeNode* node) const {
 }
 
 template <class T>
-void AVL<T>::rotate_left(TreeNode*& node) {
-  TreeNode* child = node->right;
-  node->right = child->left;
-  child->left = node;
-  node->height = 1 + std::max(height(node->left), height(node->right));
-  child->height = 1 + std::max(height(child->left), height(child->right));
-  node = child;
+std::size_t AVL<T>::size(const TreeNode* node) const {
+  return node ? node->size : 0;
+}
+
+template <class T>
+void AVL<T>::update(TreeNode* node) {
+  node->height = 1 + std::max(height(node->child[0]), height(node->child[1]));
+  node->size = (node->removed ? 0 : 1) + size(node->child[0]) +
+               size(node->child[1]);
 }
 
 template <class T>
-void AVL<T>::rotate_right(TreeNode*& node) {
-  TreeNode* child = node->left;
-  node->left = child->right;
-  child->right = node;
-  node->height = 1 + std::max(height(node->left), height(node->right));
-  child->height = 1 + std::max(height(child->left), height(child->right));
+void AVL<T>::rotate(TreeNode*& node, int dir) {
+  TreeNode* child = node->child[dir];
+  node->child[dir] = child->child[1 - dir];
+  child->child[1 - dir] = node;
+  update(node);
+  update(child);
   node = child;
 }
 
@@ -304,44 +1195,42 @@ template <class T>
 void AVL<T>::balance(TreeNode*& node) {
   if (node == nullptr) return;
 
-  // Atualiza a altura do nó atual
-  node->height = 1 + std::max(height(node->left), height(node->right));
+  // Atualiza a altura e o tamanho do nó atual
+  update(node);
 
   // Calcula o fator de balanceamento
-  int balance_factor = height(node->left) - height(node->right);
+  int balance_factor = height(node->child[0]) - height(node->child[1]);
+  if (balance_factor >= -1 && balance_factor <= 1) return;
 
-  // Caso Esquerda-Esquerda (Rotação à Direita)
-  if (balance_factor > 1 && (height(node->left->left) >= height(node->left->right))) {
-    rotate_right(node);
-  }
-  // Caso Direita-Direita (Rotação à Esquerda)
-  else if (balance_factor < -1 && (height(node->right->right) >= height(node->right->left))) {
-    rotate_left(node);
-  }
-  // Caso Esquerda-Direita (Rotação Dupla)
-  else if (balance_factor > 1) {
-    rotate_left(node->left);
-    rotate_right(node);
-  }
-  // Caso Direita-Esquerda (Rotação Dupla)
-  else if (balance_factor < -1) {
-    rotate_right(node->right);
-    rotate_left(node);
+  // Lado mais alto; os casos espelhados diferem apenas por esse índice
+  int heavy = balance_factor < 0;
+  TreeNode* child = node->child[heavy];
+
+  // Caso em zigue-zague (rotação dupla): endireita o filho primeiro
+  if (height(child->child[1 - heavy]) > height(child->child[heavy])) {
+    rotate(node->child[heavy], 1 - heavy);
   }
+  rotate(node, heavy);
 }
 
 // Implementações de AVL (Funções Privadas Recursivas)
 template <class T>
-bool AVL<T>::insert(TreeNode*& node, const T& value) {
+bool AVL<T>::insert(TreeNode*& node, const T& value, TreeNode*& found) {
   bool inserted;
   if (node == nullptr) {
     node = new TreeNode(value);
+    found = node;
     inserted = true;
   } else if (value < node->data) {
-    inserted = insert(node->left, value);
+    inserted = insert(node->child[0], value, found);
   } else if (node->data < value) {
-    inserted = insert(node->right, value);
+    inserted = insert(node->child[1], value, found);
+  } else if (node->removed) {
+    revive(node, new TreeNode(value));
+    found = node;
+    inserted = true;
   } else {
+    found = node;
     return false; // Duplicado
   }
 
@@ -352,45 +1241,59 @@ bool AVL<T>::insert(TreeNode*& node, const T& value) {
 }
 
 template <class T>
-bool AVL<T>::contain(const TreeNode* const node, const T& value) const {
-  if (node == nullptr) {
-    return false;
-  }
-  if (value < node->data) {
-    return contain(node->left, value);
-  }
-  if (node->data < value) {
-    return contain(node->right, value);
+template <class Q>
+bool AVL<T>::contain(const TreeNode* const node, const Q& value) const {
+  if constexpr (std::is_arithmetic_v<T> && std::same_as<Q, T>) {
+    const TreeNode* found = branchless_find(node, value);
+    return found != nullptr && !found->removed;
+  } else {
+    if (node == nullptr) {
+      return false;
+    }
+    if (value < node->data) {
+      return contain(node->child[0], value);
+    }
+    if (node->data < value) {
+      return contain(node->child[1], value);
+    }
+    return !node->removed;
   }
-  return true;
 }
 
 template <class T>
-bool AVL<T>::remove(TreeNode*& node, const T& value) {
+template <class Q>
+bool AVL<T>::remove(TreeNode*& node, const Q& value) {
   if (node == nullptr) {
     return false;
   }
 
   bool removed;
   if (value < node->data) {
-    removed = remove(node->left, value);
+    removed = remove(node->child[0], value);
   } else if (node->data < value) {
-    removed = remove(node->right, value);
+    removed = remove(node->child[1], value);
+  } else if (node->removed) {
+    return false;  // Já removido por `remove_lazy`
   } else {
     // Nó encontrado
     TreeNode* temp = node;
-    if (node->left == nullptr) {
-      node = node->right;
-      temp->right = nullptr;
+    if (node->child[0] == nullptr) {
+      node = node->child[1];
+      temp->child[1] = nullptr;
       delete temp;
-    } else if (node->right == nullptr) {
-      node = node->left;
-      temp->left = nullptr;
+    } else if (node->child[1] == nullptr) {
+      node = node->child[0];
+      temp->child[0] = nullptr;
       delete temp;
     } else {
-      TreeNode* successor = node->right->min();
-      node->data = successor->data;
-      remove(node->right, successor->data);
+      // Religa o sucessor no lugar do nó, sem copiar dados: os demais nós
+      // mantêm o endereço
+      TreeNode* successor = extract_min(node->child[1]);
+      successor->child[0] = node->child[0];
+      successor->child[1] = node->child[1];
+      node = successor;
+      temp->child[0] = temp->child[1] = nullptr;
+      delete temp;
     }
     removed = true;
   }
@@ -428,25 +1331,604 @@ template <class T>
 void AVL<T>::in_order(const TreeNode* const node,
                       std::vector<T>& result) const {
   if (node == nullptr) return;
-  in_order(node->left, result);
-  result.push_back(node->data);
-  in_order(node->right, result);
+  in_order(node->child[0], result);
+  if (!node->removed) result.push_back(node->data);
+  in_order(node->child[1], result);
 }
 
 template <class T>
 void AVL<T>::pre_order(const TreeNode* const node,
                        std::vector<T>& result) const {
   if (node == nullptr) return;
-  result.push_back(node->data);
-  pre_order(node->left, result);
-  pre_order(node->right, result);
+  if (!node->removed) result.push_back(node->data);
+  pre_order(node->child[0], result);
+  pre_order(node->child[1], result);
 }
 
 template <class T>
 void AVL<T>::post_order(const TreeNode* const node,
                         std::vector<T>& result) const {
   if (node == nullptr) return;
-  post_order(node->left, result);
-  post_order(node->right, result);
-  result.push_back(node->data);
-}
\ No newline at end of file
+  post_order(node->child[0], result);
+  post_order(node->child[1], result);
+  if (!node->removed) result.push_back(node->data);
+}
+
+// Implementações de Travessia Preguiçosa (Corrotinas)
+// Usam uma pilha explícita: cada elemento custa O(1) amortizado e a memória
+// extra é proporcional à altura da árvore.
+template <class T>
+Generator<T> AVL<T>::lazy_in_order() const {
+  std::vector<const TreeNode*> stack;
+  const TreeNode* node = root;
+  while (node != nullptr || !stack.empty()) {
+    while (node != nullptr) {
+      stack.push_back(node);
+      node = node->child[0];
+    }
+    node = stack.back();
+    stack.pop_back();
+    if (!node->removed) co_yield node->data;
+    node = node->child[1];
+  }
+}
+
+template <class T>
+Generator<T> AVL<T>::lazy_range(T first, T last) const {
+  // A pilha guarda os ancestrais ainda não visitados que não precedem `first`
+  std::vector<const TreeNode*> stack;
+  for (const TreeNode* node = root; node != nullptr;) {
+    if (node->data < first) {
+      node = node->child[1];
+    } else {
+      stack.push_back(node);
+      node = node->child[0];
+    }
+  }
+  while (!stack.empty()) {
+    const TreeNode* node = stack.back();
+    stack.pop_back();
+    if (!(node->data < last)) co_return;
+    if (!node->removed) co_yield node->data;
+    for (node = node->child[1]; node != nullptr; node = node->child[0]) {
+      stack.push_back(node);
+    }
+  }
+}
+
+template <class T>
+Generator<T> AVL<T>::lazy_pre_order() const {
+  std::vector<const TreeNode*> stack;
+  if (root != nullptr) stack.push_back(root);
+  while (!stack.empty()) {
+    const TreeNode* node = stack.back();
+    stack.pop_back();
+    if (!node->removed) co_yield node->data;
+    if (node->child[1] != nullptr) stack.push_back(node->child[1]);
+    if (node->child[0] != nullptr) stack.push_back(node->child[0]);
+  }
+}
+
+template <class T>
+Generator<T> AVL<T>::lazy_post_order() const {
+  std::vector<const TreeNode*> stack;
+  const TreeNode* node = root;
+  const TreeNode* last = nullptr;  // Último nó produzido
+  while (node != nullptr || !stack.empty()) {
+    if (node != nullptr) {
+      stack.push_back(node);
+      node = node->child[0];
+      continue;
+    }
+    const TreeNode* top = stack.back();
+    if (top->child[1] != nullptr && top->child[1] != last) {
+      node = top->child[1];
+    } else {
+      if (!top->removed) co_yield top->data;
+      last = top;
+      stack.pop_back();
+    }
+  }
+}
+
+// Implementações de Exportação Paralela
+template <class T>
+template <class U, class Projection>
+void AVL<T>::parallel_in_order(std::span<U> out, Projection project) const {
+  if (out.size() < size()) {
+    throw std::out_of_range("Output span smaller than the tree");
+  }
+  parallel_in_order(root, out.first(size()), project);
+}
+
+template <class T>
+template <class U, class Projection>
+void AVL<T>::parallel_in_order(const TreeNode* const node, std::span<U> out,
+                               const Projection& project) const {
+  if (node == nullptr) return;
+  std::size_t left_size = size(node->child[0]);
+  std::size_t own = node->removed ? 0 : 1;
+  std::span<U> left_out = out.first(left_size);
+  std::span<U> right_out = out.subspan(left_size + own);
+
+  if (own) out[left_size] = project(node->data);
+  fork(
+      node->size, [&] { parallel_in_order(node->child[0], left_out, project); },
+      [&] { parallel_in_order(node->child[1], right_out, project); });
+}
+
+// Implementações de Algoritmos Paralelos
+template <class T>
+template <class Visitor>
+void AVL<T>::parallel_for_each(Visitor visit) const {
+  parallel_for_each(root, visit);
+}
+
+template <class T>
+template <class Visitor>
+void AVL<T>::parallel_for_each(const TreeNode* const node,
+                               const Visitor& visit) const {
+  if (node == nullptr) return;
+  if (!node->removed) visit(node->data);
+  fork(
+      node->size, [&] { parallel_for_each(node->child[0], visit); },
+      [&] { parallel_for_each(node->child[1], visit); });
+}
+
+template <class T>
+template <class R, class Mapper, class Reducer>
+R AVL<T>::parallel_reduce(R identity, Mapper mapper, Reducer reducer) const {
+  return parallel_reduce(root, identity, mapper, reducer);
+}
+
+template <class T>
+template <class R, class Mapper, class Reducer>
+R AVL<T>::parallel_reduce(const TreeNode* const node, const R& identity,
+                          const Mapper& mapper,
+                          const Reducer& reducer) const {
+  if (node == nullptr) return identity;
+  R left = identity;
+  R right = identity;
+  fork(
+      node->size,
+      [&] {
+        left = parallel_reduce(node->child[0], identity, mapper, reducer);
+      },
+      [&] {
+        right = parallel_reduce(node->child[1], identity, mapper, reducer);
+      });
+  if (node->removed) return reducer(std::move(left), std::move(right));
+  return reducer(reducer(std::move(left), mapper(node->data)),
+                 std::move(right));
+}
+
+template <class T>
+template <class Predicate>
+AVL<T> AVL<T>::filter(Predicate pred) const {
+  AVL result;
+  result.root = result.filter(root, pred);
+  return result;
+}
+
+template <class T>
+template <class Predicate>
+typename AVL<T>::TreeNode* AVL<T>::filter(const TreeNode* const node,
+                                          const Predicate& pred) {
+  if (node == nullptr) return nullptr;
+  TreeNode* left = nullptr;
+  TreeNode* right = nullptr;
+  try {
+    fork(
+        node->size, [&] { left = filter(node->child[0], pred); },
+        [&] { right = filter(node->child[1], pred); });
+    if (!node->removed && pred(node->data)) {
+      return join(left, new TreeNode(node->data), right);
+    }
+  } catch (...) {
+    delete left;
+    delete right;
+    throw;
+  }
+  return join(left, right);
+}
+
+// Implementações de AVL (Junção e Cópia)
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::join(TreeNode* left, TreeNode* mid,
+                                        TreeNode* right) {
+  if (height(left) > height(right) + 1) {
+    left->child[1] = join(left->child[1], mid, right);
+    balance(left);
+    return left;
+  }
+  if (height(right) > height(left) + 1) {
+    right->child[0] = join(left, mid, right->child[0]);
+    balance(right);
+    return right;
+  }
+  mid->child[0] = left;
+  mid->child[1] = right;
+  update(mid);
+  return mid;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::join(TreeNode* left, TreeNode* right) {
+  if (left == nullptr) return right;
+  if (right == nullptr) return left;
+  TreeNode* mid = extract_min(right);
+  return join(left, mid, right);
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::extract_min(TreeNode*& node) {
+  if (node->child[0] == nullptr) {
+    TreeNode* min = node;
+    node = node->child[1];
+    min->child[1] = nullptr;
+    return min;
+  }
+  TreeNode* min = extract_min(node->child[0]);
+  balance(node);
+  return min;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::clone(const TreeNode* const node) {
+  if (node == nullptr) return nullptr;
+  TreeNode* copy = new TreeNode(node->data);
+  try {
+    copy->child[0] = clone(node->child[0]);
+    copy->child[1] = clone(node->child[1]);
+  } catch (...) {
+    delete copy;
+    throw;
+  }
+  copy->height = node->height;
+  copy->removed = node->removed;
+  copy->size = node->size;
+  return copy;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::build(const T* values, std::size_t count) {
+  if (count == 0) return nullptr;
+  std::size_t mid = count / 2;
+  TreeNode* node = new TreeNode(values[mid]);
+  try {
+    node->child[0] = build(values, mid);
+    node->child[1] = build(values + mid + 1, count - mid - 1);
+  } catch (...) {
+    delete node;
+    throw;
+  }
+  update(node);
+  return node;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::relink(TreeNode* const* nodes,
+                                          std::size_t count) {
+  if (count == 0) return nullptr;
+  std::size_t mid = count / 2;
+  TreeNode* node = nodes[mid];
+  node->child[0] = relink(nodes, mid);
+  node->child[1] = relink(nodes + mid + 1, count - mid - 1);
+  update(node);
+  return node;
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::split(TreeNode* node, const T& value,
+                                         TreeNode*& left, TreeNode*& right) {
+  if (node == nullptr) {
+    left = right = nullptr;
+    return nullptr;
+  }
+  TreeNode* found;
+  if (value < node->data) {
+    TreeNode* greater;
+    found = split(node->child[0], value, left, greater);
+    right = join(greater, node, node->child[1]);
+  } else if (node->data < value) {
+    TreeNode* smaller;
+    found = split(node->child[1], value, smaller, right);
+    left = join(node->child[0], node, smaller);
+  } else {
+    left = node->child[0];
+    right = node->child[1];
+    node->child[0] = node->child[1] = nullptr;
+    update(node);
+    found = node;
+  }
+  return found;
+}
+
+template <class T>
+template <class Merge>
+typename AVL<T>::TreeNode* AVL<T>::unite(TreeNode* tree, TreeNode* batch,
+                                         const Merge& merge) {
+  if (tree == nullptr) return batch;
+  if (batch == nullptr) return tree;
+
+  TreeNode *smaller, *greater;
+  TreeNode* found = split(tree, batch->data, smaller, greater);
+  TreeNode* batch_left = batch->child[0];
+  TreeNode* batch_right = batch->child[1];
+  TreeNode* left = nullptr;
+  TreeNode* right = nullptr;
+  fork(
+      size(smaller) + size(greater) + batch->size,
+      [&] { left = unite(smaller, batch_left, merge); },
+      [&] { right = unite(greater, batch_right, merge); });
+
+  TreeNode* mid = batch;
+  if (found != nullptr) {
+    // O valor já existia: mantém o nó original
+    merge(found->data, static_cast<const T&>(batch->data));
+    batch->child[0] = batch->child[1] = nullptr;
+    delete batch;
+    mid = found;
+  }
+  return join(left, mid, right);
+}
+
+template <class T>
+typename AVL<T>::TreeNode* AVL<T>::difference(TreeNode* tree, const T* values,
+                                              std::size_t count) {
+  if (tree == nullptr || count == 0) return tree;
+
+  std::size_t mid = count / 2;
+  TreeNode *smaller, *greater;
+  TreeNode* found = split(tree, values[mid], smaller, greater);
+  TreeNode* left = nullptr;
+  TreeNode* right = nullptr;
+  fork(
+      size(smaller) + size(greater) + count,
+      [&] { left = difference(smaller, values, mid); },
+      [&] { right = difference(greater, values + mid + 1, count - mid - 1); });
+
+  delete found;
+  return join(left, right);
+}
+
+template <class T>
+template <class Range>
+std::vector<T> AVL<T>::sorted_unique(const Range& values) {
+  std::vector<T> sorted(std::ranges::begin(values), std::ranges::end(values));
+  std::stable_sort(sorted.begin(), sorted.end());
+  auto last = std::unique(sorted.begin(), sorted.end(),
+                          [](const T& a, const T& b) { return !(a < b); });
+  sorted.erase(last, sorted.end());
+  return sorted;
+}
+
+template <class T>
+template <class Range>
+std::size_t AVL<T>::insert_batch(const Range& values) {
+  purge();
+  std::vector<T> sorted = sorted_unique(values);
+  std::size_t before = size();
+  root = unite(root, build(sorted.data(), sorted.size()),
+               [](T&, const T&) {});
+  return size() - before;
+}
+
+template <class T>
+template <class Range, class Merge>
+std::size_t AVL<T>::insert_batch(const Range& values, Merge merge) {
+  purge();
+  std::vector<T> sorted = sorted_unique(values);
+  std::size_t before = size();
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto guarded = [&](T& existing, const T& incoming) {
+    try {
+      merge(existing, incoming);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+    }
+  };
+  root = unite(root, build(sorted.data(), sorted.size()), guarded);
+  if (error) std::rethrow_exception(error);
+  return size() - before;
+}
+
+template <class T>
+template <class Range>
+std::size_t AVL<T>::remove_batch(const Range& values) {
+  purge();
+  std::vector<T> sorted = sorted_unique(values);
+  std::size_t before = size();
+  root = difference(root, sorted.data(), sorted.size());
+  return before - size();
+}
+
+template <class T>
+template <class InsertRange, class RemoveRange>
+void AVL<T>::apply_batch(const InsertRange& inserts,
+                         const RemoveRange& removes) {
+  purge();
+  std::vector<T> sorted_removes = sorted_unique(removes);
+  std::vector<T> sorted_inserts = sorted_unique(inserts);
+  TreeNode* batch = build(sorted_inserts.data(), sorted_inserts.size());
+  root = difference(root, sorted_removes.data(), sorted_removes.size());
+  root = unite(root, batch, [](T&, const T&) {});
+}
+
+template <class T>
+const T& AVL<T>::select(std::size_t rank) const {
+  if (rank >= size()) {
+    throw std::out_of_range("Rank out of range");
+  }
+  const TreeNode* node = root;
+  while (true) {
+    std::size_t left_size = size(node->child[0]);
+    if (rank < left_size) {
+      node = node->child[0];
+    } else if (node->removed || rank > left_size) {
+      rank -= left_size + (node->removed ? 0 : 1);
+      node = node->child[1];
+    } else {
+      return node->data;
+    }
+  }
+}
+
+template <class T>
+template <class Q>
+std::size_t AVL<T>::rank(const TreeNode* node, const Q& value) const {
+  std::size_t result = 0;
+  while (node != nullptr) {
+    if (value < node->data) {
+      node = node->child[0];
+    } else if (node->data < value) {
+      result += size(node->child[0]) + (node->removed ? 0 : 1);
+      node = node->child[1];
+    } else {
+      return result + size(node->child[0]);
+    }
+  }
+  return result;
+}
+
+template <class T>
+template <std::uniform_random_bit_generator URBG>
+T AVL<T>::sample(URBG& gen) const {
+  if (size() == 0) {
+    throw std::out_of_range("Cannot sample an empty tree");
+  }
+  std::uniform_int_distribution<std::size_t> pick(0, size() - 1);
+  return select(pick(gen));
+}
+
+template <class T>
+template <std::uniform_random_bit_generator URBG>
+std::vector<T> AVL<T>::sample(std::size_t k, URBG& gen) const {
+  std::size_t n = size();
+  k = std::min(k, n);
+
+  // Algoritmo de Floyd: k posições distintas com k sorteios
+  std::unordered_set<std::size_t> chosen;
+  std::vector<std::size_t> ranks;
+  ranks.reserve(k);
+  for (std::size_t j = n - k; j < n; ++j) {
+    std::uniform_int_distribution<std::size_t> pick(0, j);
+    std::size_t rank = pick(gen);
+    if (!chosen.insert(rank).second) {
+      rank = j;
+      chosen.insert(rank);
+    }
+    ranks.push_back(rank);
+  }
+  std::sort(ranks.begin(), ranks.end());
+
+  std::vector<T> result;
+  result.reserve(k);
+  for (std::size_t rank : ranks) {
+    result.push_back(select(rank));
+  }
+  return result;
+}
+
+template <class T>
+std::mt19937_64& AVL<T>::random_engine() {
+  thread_local std::mt19937_64 engine(std::random_device{}());
+  return engine;
+}
+
+template <class T>
+template <class Before>
+std::vector<const T*> AVL<T>::select_k(std::size_t k, Before before) const {
+  // O topo do heap é o pior candidato selecionado até agora
+  auto ptr_before = [&](const T* a, const T* b) { return before(*a, *b); };
+  std::priority_queue<const T*, std::vector<const T*>, decltype(ptr_before)>
+      heap(ptr_before);
+
+  if (k > 0) {
+    for (const T& value : lazy_in_order()) {
+      if (heap.size() < k) {
+        heap.push(&value);
+      } else if (before(value, *heap.top())) {
+        heap.pop();
+        heap.push(&value);
+      }
+    }
+  }
+
+  // O heap sai do pior para o melhor: preenche o resultado de trás para a
+  // frente
+  std::vector<const T*> result(heap.size());
+  for (std::size_t i = result.size(); i > 0; --i) {
+    result[i - 1] = heap.top();
+    heap.pop();
+  }
+  return result;
+}
+
+template <class T>
+template <bool Descending>
+std::vector<T> AVL<T>::extremes(std::size_t k) const {
+  std::vector<T> result;
+  result.reserve(std::min(k, size()));
+  std::vector<const TreeNode*> stack;
+  const TreeNode* node = root;
+  while (result.size() < k && (node != nullptr || !stack.empty())) {
+    while (node != nullptr) {
+      stack.push_back(node);
+      node = Descending ? node->child[1] : node->child[0];
+    }
+    node = stack.back();
+    stack.pop_back();
+    if (!node->removed) result.push_back(node->data);
+    node = Descending ? node->child[0] : node->child[1];
+  }
+  return result;
+}
+
+template <class T>
+template <class Left, class Right>
+void AVL<T>::fork(std::size_t work, const Left& left, const Right& right) {
+  if (work < parallel_grain) {
+    left();
+    right();
+    return;
+  }
+  Scheduler::global().fork_join(left, right);
+}
+
+// Implementações de Travessia em Largura
+template <class T>
+std::vector<T> AVL<T>::level_order() const {
+  std::vector<T> result;
+  level_order([&](const T& value) { result.push_back(value); });
+  return result;
+}
+
+template <class T>
+template <class Visitor>
+void AVL<T>::level_order(Visitor visit) const {
+  std::deque<const TreeNode*> queue;
+  if (root != nullptr) queue.push_back(root);
+  while (!queue.empty()) {
+    const TreeNode* node = queue.front();
+    queue.pop_front();
+    if (!node->removed) visit(node->data);
+    if (node->child[0] != nullptr) queue.push_back(node->child[0]);
+    if (node->child[1] != nullptr) queue.push_back(node->child[1]);
+  }
+}
+
+template <class T>
+Generator<T> AVL<T>::lazy_level_order() const {
+  std::deque<const TreeNode*> queue;
+  if (root != nullptr) queue.push_back(root);
+  while (!queue.empty()) {
+    const TreeNode* node = queue.front();
+    queue.pop_front();
+    if (!node->removed) co_yield node->data;
+    if (node->child[0] != nullptr) queue.push_back(node->child[0]);
+    if (node->child[1] != nullptr) queue.push_back(node->child[1]);
+  }
+}
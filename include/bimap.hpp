@@ -0,0 +1,451 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Mapa bidirecional: associação um-para-um entre chaves e valores.
+ *
+ * Cada entrada é alocada uma única vez e participa de duas árvores AVL ao
+ * mesmo tempo: uma ordenada pela chave e outra ordenada pelo valor. O nó
+ * guarda um conjunto de ligações (filhos e altura) para cada índice, de
+ * modo que a busca nos dois sentidos custa O(log n) sem duplicar os dados
+ * em dois `Map`s.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam V Tipo do valor. Deve suportar o operador '<'.
+ */
+template <class K, class V>
+class BiMap {
+ private:
+  struct Node;
+
+  /**
+   * @brief Ligações de um nó em um dos índices.
+   */
+  struct Links {
+    Node* left = nullptr;   ///< Filho à esquerda neste índice.
+    Node* right = nullptr;  ///< Filho à direita neste índice.
+    int height = 0;         ///< Altura do nó neste índice.
+  };
+
+  /**
+   * @brief Entrada compartilhada pelos dois índices.
+   */
+  struct Node {
+    K key;           ///< A chave.
+    V value;         ///< O valor associado.
+    Links links[2];  ///< Ligações em cada índice (`by_key` e `by_value`).
+
+    Node(const K& k, const V& v) : key(k), value(v) {}
+  };
+
+  static constexpr int by_key = 0;    ///< Índice ordenado pela chave.
+  static constexpr int by_value = 1;  ///< Índice ordenado pelo valor.
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um mapa vazio.
+   */
+  BiMap();
+
+  BiMap(const BiMap& other);
+  BiMap(BiMap&& other) noexcept;
+  BiMap& operator=(BiMap other) noexcept;
+
+  /**
+   * @brief Destrutor. Libera todas as entradas.
+   */
+  ~BiMap();
+
+  /**
+   * @brief Associa `key` a `value`.
+   *
+   * A associação só é feita se nem a chave nem o valor já estiverem
+   * presentes, preservando a correspondência um-para-um.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   * @return `true` se a entrada foi inserida.
+   */
+  bool insert(const K& key, const V& value);
+
+  /**
+   * @brief Retorna o valor associado a uma chave.
+   *
+   * @param key A chave.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir.
+   */
+  const V* find_value(const K& key) const;
+
+  /**
+   * @brief Retorna a chave associada a um valor.
+   *
+   * @param value O valor.
+   * @return Ponteiro para a chave, ou nullptr se o valor não existir.
+   */
+  const K* find_key(const V& value) const;
+
+  bool contain_key(const K& key) const { return find_value(key) != nullptr; }
+  bool contain_value(const V& value) const {
+    return find_key(value) != nullptr;
+  }
+
+  /**
+   * @brief Remove a entrada com a chave informada.
+   *
+   * @return `true` se a entrada existia.
+   */
+  bool remove_key(const K& key);
+
+  /**
+   * @brief Remove a entrada com o valor informado.
+   *
+   * @return `true` se a entrada existia.
+   */
+  bool remove_value(const V& value);
+
+  /**
+   * @brief Retorna a quantidade de entradas.
+   */
+  std::size_t size() const { return count; }
+
+  /**
+   * @brief Retorna as entradas em ordem crescente de chave.
+   */
+  std::vector<std::pair<K, V>> in_order() const;
+
+ private:
+  template <int I>
+  static Links& links(Node* node) {
+    return node->links[I];
+  }
+
+  /**
+   * @brief Campo que ordena o índice `I`: a chave ou o valor.
+   */
+  template <int I>
+  static const auto& field(const Node* node) {
+    if constexpr (I == by_key) {
+      return node->key;
+    } else {
+      return node->value;
+    }
+  }
+
+  template <int I>
+  static int height(Node* node) {
+    return node ? links<I>(node).height : -1;
+  }
+
+  template <int I>
+  static void update(Node* node);
+
+  template <int I>
+  static void rotate_left(Node*& node);
+
+  template <int I>
+  static void rotate_right(Node*& node);
+
+  template <int I>
+  static void balance(Node*& node);
+
+  /**
+   * @brief Liga `entry` ao índice `I` enraizado em `node`.
+   *
+   * @return `false` (sem alterar a árvore) se o campo já estiver presente.
+   */
+  template <int I>
+  static bool link(Node*& node, Node* entry);
+
+  /**
+   * @brief Busca no índice `I` o nó cujo campo é igual a `probe`.
+   */
+  template <int I, class P>
+  static Node* find(Node* node, const P& probe);
+
+  /**
+   * @brief Desliga do índice `I` o nó cujo campo é igual a `probe`.
+   *
+   * O nó não é liberado: o sucessor é religado no seu lugar, já que os
+   * dados não podem ser copiados entre nós compartilhados por outro índice.
+   *
+   * @return O nó desligado, ou nullptr se não encontrado.
+   */
+  template <int I, class P>
+  static Node* unlink(Node*& node, const P& probe);
+
+  /**
+   * @brief Desliga e retorna o menor nó do índice `I`.
+   */
+  template <int I>
+  static Node* unlink_min(Node*& node);
+
+  /**
+   * @brief Libera as entradas percorrendo o índice por chave.
+   */
+  static void destroy(Node* node);
+
+  /**
+   * @brief Percorre o índice por chave em ordem, aplicando `visit`.
+   */
+  template <class Visitor>
+  static void for_each(Node* node, Visitor& visit);
+
+  Node* roots[2] = {nullptr, nullptr};  ///< Raízes de cada índice.
+  std::size_t count = 0;                ///< Quantidade de entradas.
+};
+
+template <class K, class V>
+BiMap<K, V>::BiMap() {}
+
+template <class K, class V>
+BiMap<K, V>::BiMap(const BiMap& other) {
+  // As entradas são criadas em um mapa local, que as libera se uma cópia
+  // lançar exceção; só depois passam para este
+  BiMap copy;
+  auto insert_copy = [&copy](const Node* node) {
+    copy.insert(node->key, node->value);
+  };
+  for_each(other.roots[by_key], insert_copy);
+  std::swap(roots, copy.roots);
+  std::swap(count, copy.count);
+}
+
+template <class K, class V>
+BiMap<K, V>::BiMap(BiMap&& other) noexcept
+    : roots{std::exchange(other.roots[by_key], nullptr),
+            std::exchange(other.roots[by_value], nullptr)},
+      count(std::exchange(other.count, 0)) {}
+
+template <class K, class V>
+BiMap<K, V>& BiMap<K, V>::operator=(BiMap other) noexcept {
+  std::swap(roots, other.roots);
+  std::swap(count, other.count);
+  return *this;
+}
+
+template <class K, class V>
+BiMap<K, V>::~BiMap() {
+  destroy(roots[by_key]);
+}
+
+template <class K, class V>
+bool BiMap<K, V>::insert(const K& key, const V& value) {
+  Node* entry = new Node(key, value);
+  bool keyed = false;
+  try {
+    // Uma comparação que lança exceção interrompe `link` antes de alterar
+    // o índice
+    keyed = link<by_key>(roots[by_key], entry);
+    if (keyed && link<by_value>(roots[by_value], entry)) {
+      ++count;
+      return true;
+    }
+  } catch (...) {
+    if (keyed) unlink<by_key>(roots[by_key], key);
+    delete entry;
+    throw;
+  }
+  if (keyed) unlink<by_key>(roots[by_key], key);
+  delete entry;
+  return false;
+}
+
+template <class K, class V>
+const V* BiMap<K, V>::find_value(const K& key) const {
+  const Node* node = find<by_key>(roots[by_key], key);
+  return node ? &node->value : nullptr;
+}
+
+template <class K, class V>
+const K* BiMap<K, V>::find_key(const V& value) const {
+  const Node* node = find<by_value>(roots[by_value], value);
+  return node ? &node->key : nullptr;
+}
+
+template <class K, class V>
+bool BiMap<K, V>::remove_key(const K& key) {
+  Node* entry = unlink<by_key>(roots[by_key], key);
+  if (entry == nullptr) return false;
+  unlink<by_value>(roots[by_value], entry->value);
+  delete entry;
+  --count;
+  return true;
+}
+
+template <class K, class V>
+bool BiMap<K, V>::remove_value(const V& value) {
+  Node* entry = unlink<by_value>(roots[by_value], value);
+  if (entry == nullptr) return false;
+  unlink<by_key>(roots[by_key], entry->key);
+  delete entry;
+  --count;
+  return true;
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> BiMap<K, V>::in_order() const {
+  std::vector<std::pair<K, V>> result;
+  result.reserve(count);
+  auto collect = [&result](const Node* node) {
+    result.emplace_back(node->key, node->value);
+  };
+  for_each(roots[by_key], collect);
+  return result;
+}
+
+template <class K, class V>
+template <int I>
+void BiMap<K, V>::update(Node* node) {
+  Links& l = links<I>(node);
+  l.height = 1 + std::max(height<I>(l.left), height<I>(l.right));
+}
+
+template <class K, class V>
+template <int I>
+void BiMap<K, V>::rotate_left(Node*& node) {
+  Node* child = links<I>(node).right;
+  links<I>(node).right = links<I>(child).left;
+  links<I>(child).left = node;
+  update<I>(node);
+  update<I>(child);
+  node = child;
+}
+
+template <class K, class V>
+template <int I>
+void BiMap<K, V>::rotate_right(Node*& node) {
+  Node* child = links<I>(node).left;
+  links<I>(node).left = links<I>(child).right;
+  links<I>(child).right = node;
+  update<I>(node);
+  update<I>(child);
+  node = child;
+}
+
+template <class K, class V>
+template <int I>
+void BiMap<K, V>::balance(Node*& node) {
+  if (node == nullptr) return;
+
+  update<I>(node);
+  Links& l = links<I>(node);
+  int balance_factor = height<I>(l.left) - height<I>(l.right);
+
+  if (balance_factor > 1) {
+    // Esquerda-Direita: rotação dupla
+    if (height<I>(links<I>(l.left).left) < height<I>(links<I>(l.left).right)) {
+      rotate_left<I>(l.left);
+    }
+    rotate_right<I>(node);
+  } else if (balance_factor < -1) {
+    // Direita-Esquerda: rotação dupla
+    if (height<I>(links<I>(l.right).right) <
+        height<I>(links<I>(l.right).left)) {
+      rotate_right<I>(l.right);
+    }
+    rotate_left<I>(node);
+  }
+}
+
+template <class K, class V>
+template <int I>
+bool BiMap<K, V>::link(Node*& node, Node* entry) {
+  if (node == nullptr) {
+    links<I>(entry) = Links();
+    node = entry;
+    return true;
+  }
+
+  bool linked;
+  if (field<I>(entry) < field<I>(node)) {
+    linked = link<I>(links<I>(node).left, entry);
+  } else if (field<I>(node) < field<I>(entry)) {
+    linked = link<I>(links<I>(node).right, entry);
+  } else {
+    return false;
+  }
+
+  if (linked) balance<I>(node);
+  return linked;
+}
+
+template <class K, class V>
+template <int I, class P>
+typename BiMap<K, V>::Node* BiMap<K, V>::find(Node* node, const P& probe) {
+  while (node != nullptr) {
+    if (probe < field<I>(node)) {
+      node = links<I>(node).left;
+    } else if (field<I>(node) < probe) {
+      node = links<I>(node).right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+template <class K, class V>
+template <int I, class P>
+typename BiMap<K, V>::Node* BiMap<K, V>::unlink(Node*& node,
+                                                const P& probe) {
+  if (node == nullptr) return nullptr;
+
+  Node* removed;
+  if (probe < field<I>(node)) {
+    removed = unlink<I>(links<I>(node).left, probe);
+  } else if (field<I>(node) < probe) {
+    removed = unlink<I>(links<I>(node).right, probe);
+  } else {
+    removed = node;
+    Links& l = links<I>(node);
+    if (l.left == nullptr) {
+      node = l.right;
+    } else if (l.right == nullptr) {
+      node = l.left;
+    } else {
+      // Religa o sucessor no lugar do nó removido
+      Node* successor = unlink_min<I>(l.right);
+      links<I>(successor).left = l.left;
+      links<I>(successor).right = l.right;
+      node = successor;
+    }
+    l = Links();
+  }
+
+  if (removed) balance<I>(node);
+  return removed;
+}
+
+template <class K, class V>
+template <int I>
+typename BiMap<K, V>::Node* BiMap<K, V>::unlink_min(Node*& node) {
+  Links& l = links<I>(node);
+  if (l.left == nullptr) {
+    Node* min = node;
+    node = l.right;
+    return min;
+  }
+  Node* min = unlink_min<I>(l.left);
+  balance<I>(node);
+  return min;
+}
+
+template <class K, class V>
+void BiMap<K, V>::destroy(Node* node) {
+  if (node == nullptr) return;
+  destroy(links<by_key>(node).left);
+  destroy(links<by_key>(node).right);
+  delete node;
+}
+
+template <class K, class V>
+template <class Visitor>
+void BiMap<K, V>::for_each(Node* node, Visitor& visit) {
+  if (node == nullptr) return;
+  for_each(links<by_key>(node).left, visit);
+  visit(node);
+  for_each(links<by_key>(node).right, visit);
+}
@@ -1,7 +1,11 @@
 #pragma once
+#include <deque>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "generator.hpp"
+
 /**
  * @brief Classe que representa uma Árvore Binária de Busca (BST).
  *
@@ -17,9 +21,9 @@ class BST {
    * @brief Estrutura interna que representa um nó da árvore.
    */
   struct TreeNode {
-    T data;           ///< Valor armazenado no nó.
-    TreeNode* left;   ///< Ponteiro para o filho à esquerda.
-    TreeNode* right;  ///< Ponteiro para o filho à direita.
+    T data;              ///< Valor armazenado no nó.
+    TreeNode* child[2];  ///< Filhos: `child[0]` à esquerda e `child[1]` à
+                         ///< direita (o índice é `data < valor`).
 
     /**
      * @brief Construtor que inicializa o nó com um valor.
@@ -111,17 +115,43 @@ class BST {
    */
   void post_order(const TreeNode* const node, std::vector<T>& result) const;
 
-  TreeNode* find_node(TreeNode* node, const T& value) const {
-    if (node == nullptr) {
-      return nullptr;
+  /**
+   * @brief Busca sem desvios condicionais para chaves aritméticas.
+   *
+   * O filho seguinte é escolhido pelo índice `data < value` em vez de um
+   * `if`: a descida vira uma cadeia de leituras dependentes, sem os erros de
+   * previsão de desvio que dominam a busca quando as chaves são aleatórias.
+   * Só a igualdade encerra o laço mais cedo.
+   *
+   * @param node Raiz da subárvore.
+   * @param value O valor procurado.
+   * @return O nó com o valor, ou nullptr.
+   */
+  template <class Node>
+  static Node* branchless_find(Node* node, const T& value) {
+    while (node != nullptr) {
+      bool greater = node->data < value;
+      if (!greater && !(value < node->data)) break;
+      node = node->child[greater];
     }
+    return node;
+  }
 
-    if (value < node->data) {
-      return find_node(node->left, value);
-    } else if (node->data < value) {
-      return find_node(node->right, value);
+  TreeNode* find_node(TreeNode* node, const T& value) const {
+    if constexpr (std::is_arithmetic_v<T>) {
+      return branchless_find(node, value);
     } else {
-      return node;
+      if (node == nullptr) {
+        return nullptr;
+      }
+
+      if (value < node->data) {
+        return find_node(node->child[0], value);
+      } else if (node->data < value) {
+        return find_node(node->child[1], value);
+      } else {
+        return node;
+      }
     }
   }
 
@@ -187,6 +217,65 @@ class BST {
    */
   std::vector<T> post_order() const;
 
+  /**
+   * @brief Percorre a árvore em ordem (in-order) de forma preguiçosa.
+   *
+   * Os valores são produzidos um a um, sem construir o vetor completo, o que
+   * permite interromper a travessia antecipadamente ou encadeá-la com views
+   * de `std::ranges`. A árvore não deve ser modificada enquanto o gerador
+   * estiver em uso.
+   *
+   * @return Gerador com os valores em ordem.
+   */
+  Generator<T> lazy_in_order() const;
+
+  /**
+   * @brief Percorre a árvore em pré-ordem (pre-order) de forma preguiçosa.
+   *
+   * Útil para serializar apenas um prefixo da árvore: somente os nós
+   * efetivamente consumidos são visitados.
+   *
+   * @return Gerador com os valores em pré-ordem.
+   */
+  Generator<T> lazy_pre_order() const;
+
+  /**
+   * @brief Percorre a árvore em pós-ordem (post-order) de forma preguiçosa.
+   *
+   * @return Gerador com os valores em pós-ordem.
+   */
+  Generator<T> lazy_post_order() const;
+
+  /**
+   * @brief Retorna os valores da árvore em ordem de nível (busca em largura).
+   *
+   * Visita a raiz, depois todos os nós do nível 1 da esquerda para a direita,
+   * e assim por diante. Reinserir os valores nesta ordem em uma árvore vazia
+   * reproduz o mesmo formato, sem necessidade de rebalanceamento.
+   *
+   * @return Vetor com os valores em ordem de nível.
+   */
+  std::vector<T> level_order() const;
+
+  /**
+   * @brief Visita os valores da árvore em ordem de nível.
+   *
+   * @param visit Função `void(const T&)` chamada para cada valor.
+   */
+  template <class Visitor>
+  void level_order(Visitor visit) const;
+
+  /**
+   * @brief Percorre a árvore em ordem de nível de forma preguiçosa.
+   *
+   * A memória extra é proporcional à largura do nível mais largo já
+   * alcançado. A árvore não deve ser modificada enquanto o gerador estiver
+   * em uso.
+   *
+   * @return Gerador com os valores em ordem de nível.
+   */
+  Generator<T> lazy_level_order() const;
+
   /**
    * @brief Retorna o ponteiro para o nodo contendo o valor.
    *
@@ -201,28 +290,28 @@ class BST {
 // Implementações de TreeNode
 template <class T>
 BST<T>::TreeNode::TreeNode(const T& value)
-    : data(value), left(nullptr), right(nullptr) {}
+    : data(value), child{nullptr, nullptr} {}
 
 template <class T>
 BST<T>::TreeNode::~TreeNode() {
-  delete left;
-  delete right;
+  delete child[0];
+  delete child[1];
 }
 
 template <class T>
 typename BST<T>::TreeNode* BST<T>::TreeNode::max() {
-  if (right == nullptr) {
+  if (child[1] == nullptr) {
     return this;
   }
-  return right->max();
+  return child[1]->max();
 }
 
 template <class T>
 typename BST<T>::TreeNode* BST<T>::TreeNode::min() {
-  if (left == nullptr) {
+  if (child[0] == nullptr) {
     return this;
   }
-  return left->min();
+  return child[0]->min();
 }
 
 // Implementações de BST (Construtor e Destrutor)
@@ -258,10 +347,10 @@ bool BST<T>::insert(TreeNode*& node, const T& value) {
     return true;
   }
   if (value < node->data) {
-    return insert(node->left, value);
+    return insert(node->child[0], value);
   }
   if (node->data < value) {
-    return insert(node->right, value);
+    return insert(node->child[1], value);
   }
   // O valor já existe
   return false;
@@ -269,17 +358,21 @@ bool BST<T>::insert(TreeNode*& node, const T& value) {
 
 template <class T>
 bool BST<T>::contain(const TreeNode* const node, const T& value) const {
-  if (node == nullptr) {
-    return false;
-  }
-  if (value < node->data) {
-    return contain(node->left, value);
-  }
-  if (node->data < value) {
-    return contain(node->right, value);
+  if constexpr (std::is_arithmetic_v<T>) {
+    return branchless_find(node, value) != nullptr;
+  } else {
+    if (node == nullptr) {
+      return false;
+    }
+    if (value < node->data) {
+      return contain(node->child[0], value);
+    }
+    if (node->data < value) {
+      return contain(node->child[1], value);
+    }
+    // Encontrou o valor
+    return true;
   }
-  // Encontrou o valor
-  return true;
 }
 
 template <class T>
@@ -289,31 +382,31 @@ bool BST<T>::remove(TreeNode*& node, const T& value) {
   }
 
   if (value < node->data) {
-    return remove(node->left, value);
+    return remove(node->child[0], value);
   }
   if (node->data < value) {
-    return remove(node->right, value);
+    return remove(node->child[1], value);
   }
 
   // Nó encontrado. Agora, os casos de remoção:
   TreeNode* temp = node;
-  if (node->left == nullptr) {
+  if (node->child[0] == nullptr) {
     // Caso 1: Nó com 0 ou 1 filho (à direita)
-    node = node->right;
-    temp->right = nullptr; // Evita deleção recursiva do filho
+    node = node->child[1];
+    temp->child[1] = nullptr; // Evita deleção recursiva do filho
     delete temp;
-  } else if (node->right == nullptr) {
+  } else if (node->child[1] == nullptr) {
     // Caso 2: Nó com 1 filho (à esquerda)
-    node = node->left;
-    temp->left = nullptr; // Evita deleção recursiva do filho
+    node = node->child[0];
+    temp->child[0] = nullptr; // Evita deleção recursiva do filho
     delete temp;
   } else {
     // Caso 3: Nó com 2 filhos
     // Encontra o sucessor in-order (menor da subárvore direita)
-    TreeNode* successor = node->right->min();
+    TreeNode* successor = node->child[1]->min();
     node->data = successor->data;
     // Remove o nó sucessor da subárvore direita
-    remove(node->right, successor->data);
+    remove(node->child[1], successor->data);
   }
   return true;
 }
@@ -347,9 +440,9 @@ void BST<T>::in_order(const TreeNode* const node,
   if (node == nullptr) {
     return;
   }
-  in_order(node->left, result);
+  in_order(node->child[0], result);
   result.push_back(node->data);
-  in_order(node->right, result);
+  in_order(node->child[1], result);
 }
 
 template <class T>
@@ -359,8 +452,8 @@ void BST<T>::pre_order(const TreeNode* const node,
     return;
   }
   result.push_back(node->data);
-  pre_order(node->left, result);
-  pre_order(node->right, result);
+  pre_order(node->child[0], result);
+  pre_order(node->child[1], result);
 }
 
 template <class T>
@@ -369,7 +462,96 @@ void BST<T>::post_order(const TreeNode* const node,
   if (node == nullptr) {
     return;
   }
-  post_order(node->left, result);
-  post_order(node->right, result);
+  post_order(node->child[0], result);
+  post_order(node->child[1], result);
   result.push_back(node->data);
-}
\ No newline at end of file
+}
+
+// Implementações de Travessia Preguiçosa (Corrotinas)
+// Usam uma pilha explícita: cada elemento custa O(1) amortizado e a memória
+// extra é proporcional à altura da árvore.
+template <class T>
+Generator<T> BST<T>::lazy_in_order() const {
+  std::vector<const TreeNode*> stack;
+  const TreeNode* node = root;
+  while (node != nullptr || !stack.empty()) {
+    while (node != nullptr) {
+      stack.push_back(node);
+      node = node->child[0];
+    }
+    node = stack.back();
+    stack.pop_back();
+    co_yield node->data;
+    node = node->child[1];
+  }
+}
+
+template <class T>
+Generator<T> BST<T>::lazy_pre_order() const {
+  std::vector<const TreeNode*> stack;
+  if (root != nullptr) stack.push_back(root);
+  while (!stack.empty()) {
+    const TreeNode* node = stack.back();
+    stack.pop_back();
+    co_yield node->data;
+    if (node->child[1] != nullptr) stack.push_back(node->child[1]);
+    if (node->child[0] != nullptr) stack.push_back(node->child[0]);
+  }
+}
+
+template <class T>
+Generator<T> BST<T>::lazy_post_order() const {
+  std::vector<const TreeNode*> stack;
+  const TreeNode* node = root;
+  const TreeNode* last = nullptr;  // Último nó produzido
+  while (node != nullptr || !stack.empty()) {
+    if (node != nullptr) {
+      stack.push_back(node);
+      node = node->child[0];
+      continue;
+    }
+    const TreeNode* top = stack.back();
+    if (top->child[1] != nullptr && top->child[1] != last) {
+      node = top->child[1];
+    } else {
+      co_yield top->data;
+      last = top;
+      stack.pop_back();
+    }
+  }
+}
+
+// Implementações de Travessia em Largura
+template <class T>
+std::vector<T> BST<T>::level_order() const {
+  std::vector<T> result;
+  level_order([&](const T& value) { result.push_back(value); });
+  return result;
+}
+
+template <class T>
+template <class Visitor>
+void BST<T>::level_order(Visitor visit) const {
+  std::deque<const TreeNode*> queue;
+  if (root != nullptr) queue.push_back(root);
+  while (!queue.empty()) {
+    const TreeNode* node = queue.front();
+    queue.pop_front();
+    visit(node->data);
+    if (node->child[0] != nullptr) queue.push_back(node->child[0]);
+    if (node->child[1] != nullptr) queue.push_back(node->child[1]);
+  }
+}
+
+template <class T>
+Generator<T> BST<T>::lazy_level_order() const {
+  std::deque<const TreeNode*> queue;
+  if (root != nullptr) queue.push_back(root);
+  while (!queue.empty()) {
+    const TreeNode* node = queue.front();
+    queue.pop_front();
+    co_yield node->data;
+    if (node->child[0] != nullptr) queue.push_back(node->child[0]);
+    if (node->child[1] != nullptr) queue.push_back(node->child[1]);
+  }
+}
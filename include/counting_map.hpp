@@ -0,0 +1,219 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "avl.hpp"
+
+/**
+ * @brief Mapa de contagens (histograma) especializado para frequências.
+ *
+ * Cada nó da árvore AVL guarda apenas a chave e um contador inteiro, sem o
+ * valor padrão genérico de `Map`. Incrementar uma chave (nova ou existente)
+ * custa uma única descida na árvore, e lotes de chaves são ordenados e
+ * agrupados antes de serem aplicados.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam Count Tipo inteiro do contador.
+ */
+template <class K, class Count = std::size_t>
+class CountingMap {
+  static_assert(std::is_integral_v<Count>,
+                "CountingMap requires an integral count type");
+
+ private:
+  /**
+   * @brief Par compacto chave-contador armazenado em cada nó.
+   */
+  struct Counter {
+    K key;        ///< A chave contada.
+    Count count;  ///< Quantidade acumulada.
+
+    explicit Counter(const K& k, Count c = 0) : key(k), count(c) {}
+
+    bool operator<(const Counter& other) const { return key < other.key; }
+
+    /**
+     * @brief Comparações com uma chave avulsa (`K` ou um tipo comparável
+     * com `K`), usadas nas buscas para não construir um Counter.
+     */
+    template <class Q>
+      requires(!std::same_as<Q, Counter> && LessComparableWith<Q, K>)
+    friend bool operator<(const Counter& counter, const Q& key) {
+      return counter.key < key;
+    }
+
+    template <class Q>
+      requires(!std::same_as<Q, Counter> && LessComparableWith<Q, K>)
+    friend bool operator<(const Q& key, const Counter& counter) {
+      return key < counter.key;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um histograma vazio.
+   */
+  CountingMap();
+
+  /**
+   * @brief Soma `delta` ao contador da chave, criando-o se necessário.
+   *
+   * A busca compara a chave diretamente: só uma chave nova é copiada para
+   * um Counter.
+   *
+   * @param key A chave.
+   * @param delta Valor a somar.
+   * @return O novo valor do contador.
+   */
+  Count increment(const K& key, Count delta = 1);
+
+  /**
+   * @brief Conta cada ocorrência de um lote de chaves.
+   *
+   * O lote é ordenado e as ocorrências repetidas são agrupadas, de modo que
+   * cada chave distinta é aplicada uma vez, em uma única passada de divisão
+   * e junção da árvore.
+   *
+   * @param keys Intervalo de chaves; cada ocorrência soma 1.
+   * @return Quantidade de chaves novas.
+   */
+  template <class Range>
+  std::size_t increment_batch(const Range& keys);
+
+  /**
+   * @brief Retorna o contador de uma chave.
+   *
+   * @param key A chave.
+   * @return O contador, ou 0 se a chave nunca foi contada.
+   */
+  Count count(const K& key) const;
+
+  /**
+   * @brief Retorna o contador de uma chave de outro tipo (por exemplo,
+   * `std::string_view` em um histograma de `std::string`), sem construir
+   * um `K`.
+   */
+  template <HeterogeneousKey<K> Q>
+  Count count(const Q& key) const;
+
+  /**
+   * @brief Remove o contador de uma chave.
+   *
+   * @param key A chave.
+   * @return `true` se a chave existia.
+   */
+  bool remove(const K& key);
+
+  /**
+   * @brief Remove o contador de uma chave de outro tipo, sem construir um
+   * `K`.
+   *
+   * @return `true` se a chave existia.
+   */
+  template <HeterogeneousKey<K> Q>
+  bool remove(const Q& key);
+
+  /**
+   * @brief Retorna a quantidade de chaves distintas.
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Retorna as `n` chaves com os maiores contadores.
+   *
+   * Percorre os contadores mantendo apenas os `n` maiores, em O(m log n)
+   * para m chaves distintas. Empates são resolvidos pela menor chave.
+   *
+   * @param n Quantidade de chaves desejadas.
+   * @return Pares (chave, contador) em ordem decrescente de contador.
+   */
+  std::vector<std::pair<K, Count>> top_k(std::size_t n) const;
+
+ private:
+  AVL<Counter> data;  ///< Árvore com os contadores, ordenada pela chave.
+};
+
+template <class K, class Count>
+CountingMap<K, Count>::CountingMap() {}
+
+template <class K, class Count>
+Count CountingMap<K, Count>::increment(const K& key, Count delta) {
+  auto* node = data.find_node(key);
+  if (node == nullptr) {
+    node = data.insert_or_find(Counter(key)).first;
+  }
+  node->data.count += delta;
+  return node->data.count;
+}
+
+template <class K, class Count>
+template <class Range>
+std::size_t CountingMap<K, Count>::increment_batch(const Range& keys) {
+  std::vector<K> sorted(std::ranges::begin(keys), std::ranges::end(keys));
+  std::sort(sorted.begin(), sorted.end());
+
+  // Agrupa as ocorrências repetidas em um único contador
+  std::vector<Counter> counters;
+  for (const K& key : sorted) {
+    if (!counters.empty() && !(counters.back().key < key)) {
+      ++counters.back().count;
+    } else {
+      counters.emplace_back(key, 1);
+    }
+  }
+
+  return data.insert_batch(
+      counters, [](Counter& existing, const Counter& incoming) {
+        existing.count += incoming.count;
+      });
+}
+
+template <class K, class Count>
+Count CountingMap<K, Count>::count(const K& key) const {
+  const auto* node = data.find_node(key);
+  return node ? node->data.count : 0;
+}
+
+template <class K, class Count>
+template <HeterogeneousKey<K> Q>
+Count CountingMap<K, Count>::count(const Q& key) const {
+  const auto* node = data.find_node(key);
+  return node ? node->data.count : 0;
+}
+
+template <class K, class Count>
+bool CountingMap<K, Count>::remove(const K& key) {
+  return data.remove(key);
+}
+
+template <class K, class Count>
+template <HeterogeneousKey<K> Q>
+bool CountingMap<K, Count>::remove(const Q& key) {
+  return data.remove(key);
+}
+
+template <class K, class Count>
+std::size_t CountingMap<K, Count>::size() const {
+  return data.size();
+}
+
+template <class K, class Count>
+std::vector<std::pair<K, Count>> CountingMap<K, Count>::top_k(
+    std::size_t n) const {
+  // Maiores contadores primeiro; empates pela menor chave
+  auto better = [](const Counter& a, const Counter& b) {
+    if (a.count != b.count) return a.count > b.count;
+    return a.key < b.key;
+  };
+
+  std::vector<std::pair<K, Count>> result;
+  for (const Counter* counter : data.select_k(n, better)) {
+    result.emplace_back(counter->key, counter->count);
+  }
+  return result;
+}
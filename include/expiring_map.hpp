@@ -0,0 +1,216 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+#include "avl.hpp"
+
+/**
+ * @brief Mapa associativo cujas entradas expiram em um prazo.
+ *
+ * Cada entrada tem um prazo (deadline). Além da árvore principal, ordenada
+ * pela chave, um índice AVL ordenado por (prazo, chave) permite encontrar as
+ * entradas vencidas a partir da menor, sem percorrer o mapa: `expire(now)`
+ * remove k entradas vencidas em O(k log n). Entradas vencidas que ainda não
+ * foram removidas ficam ocultas nas buscas.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam V Tipo do valor associado à chave.
+ * @tparam Clock Relógio que define o tipo dos prazos.
+ */
+template <class K, class V, class Clock = std::chrono::steady_clock>
+class ExpiringMap {
+ public:
+  using time_point = typename Clock::time_point;
+  using duration = typename Clock::duration;
+
+ private:
+  /**
+   * @brief Entrada da árvore principal, ordenada pela chave.
+   */
+  struct Entry {
+    K key;                ///< A chave única.
+    V value;              ///< O valor associado.
+    time_point deadline;  ///< Instante a partir do qual a entrada expira.
+
+    Entry(const K& k, const V& v, time_point d)
+        : key(k), value(v), deadline(d) {}
+
+    bool operator<(const Entry& other) const { return key < other.key; }
+  };
+
+  /**
+   * @brief Chave de busca na árvore principal, sem construir um `V`.
+   */
+  struct Probe {
+    const K& key;  ///< A chave procurada.
+
+    friend bool operator<(const Entry& entry, const Probe& probe) {
+      return entry.key < probe.key;
+    }
+    friend bool operator<(const Probe& probe, const Entry& entry) {
+      return probe.key < entry.key;
+    }
+  };
+
+  /**
+   * @brief Entrada do índice de prazos, ordenada por (prazo, chave).
+   */
+  struct Deadline {
+    time_point deadline;  ///< Prazo da entrada.
+    K key;                ///< Chave da entrada no mapa.
+
+    bool operator<(const Deadline& other) const {
+      if (deadline != other.deadline) return deadline < other.deadline;
+      return key < other.key;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um mapa vazio.
+   */
+  ExpiringMap();
+
+  /**
+   * @brief Associa `value` à chave até o instante `deadline`.
+   *
+   * Se a chave já existir, o valor e o prazo são substituídos.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   * @param deadline Instante a partir do qual a entrada expira.
+   * @return `true` se a chave era nova.
+   */
+  bool insert(const K& key, const V& value, time_point deadline);
+
+  /**
+   * @brief Associa `value` à chave por um intervalo de tempo.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   * @param ttl Tempo de vida da entrada, contado a partir de `now`.
+   * @param now Instante atual.
+   * @return `true` se a chave era nova.
+   */
+  bool insert_for(const K& key, const V& value, duration ttl,
+                  time_point now = Clock::now()) {
+    return insert(key, value, now + ttl);
+  }
+
+  /**
+   * @brief Busca o valor de uma chave que ainda não expirou.
+   *
+   * @param key A chave.
+   * @param now Instante atual.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir ou já
+   * tiver expirado em `now`.
+   */
+  const V* find(const K& key, time_point now = Clock::now()) const;
+
+  /**
+   * @brief Retorna o prazo de uma chave.
+   *
+   * @param key A chave.
+   * @return Ponteiro para o prazo, ou nullptr se a chave não existir.
+   */
+  const time_point* deadline(const K& key) const;
+
+  /**
+   * @brief Remove uma chave, expirada ou não.
+   *
+   * @return `true` se a chave existia.
+   */
+  bool remove(const K& key);
+
+  /**
+   * @brief Remove as entradas cujo prazo é menor ou igual a `now`.
+   *
+   * Retira as entradas a partir do menor prazo, parando na primeira que
+   * ainda é válida: O(k log n) para k entradas removidas.
+   *
+   * @param now Instante atual.
+   * @return Quantidade de entradas removidas.
+   */
+  std::size_t expire(time_point now = Clock::now());
+
+  /**
+   * @brief Retorna a quantidade de entradas, incluindo as expiradas que
+   * ainda não foram removidas por `expire`.
+   */
+  std::size_t size() const { return data.size(); }
+
+ private:
+  AVL<Entry> data;          ///< Entradas ordenadas pela chave.
+  AVL<Deadline> deadlines;  ///< Índice ordenado pelo prazo.
+};
+
+template <class K, class V, class Clock>
+ExpiringMap<K, V, Clock>::ExpiringMap() {}
+
+template <class K, class V, class Clock>
+bool ExpiringMap<K, V, Clock>::insert(const K& key, const V& value,
+                                      time_point deadline) {
+  if (auto* node = data.find_node(Probe{key})) {
+    // Indexa o novo prazo antes de trocar o valor e só então solta o antigo:
+    // se algo lançar, a entrada continua alcançável por `expire`
+    Entry& entry = node->data;
+    bool moved = entry.deadline != deadline;
+    if (moved) deadlines.insert(Deadline{deadline, key});
+    try {
+      entry.value = value;
+    } catch (...) {
+      if (moved) deadlines.remove(Deadline{deadline, key});
+      throw;
+    }
+    if (moved) {
+      deadlines.remove(Deadline{entry.deadline, key});
+      entry.deadline = deadline;
+    }
+    return false;
+  }
+
+  data.insert_or_find(Entry(key, value, deadline));
+  try {
+    deadlines.insert(Deadline{deadline, key});
+  } catch (...) {
+    data.remove(Probe{key});
+    throw;
+  }
+  return true;
+}
+
+template <class K, class V, class Clock>
+const V* ExpiringMap<K, V, Clock>::find(const K& key, time_point now) const {
+  const auto* node = data.find_node(Probe{key});
+  if (node == nullptr || node->data.deadline <= now) return nullptr;
+  return &node->data.value;
+}
+
+template <class K, class V, class Clock>
+const typename ExpiringMap<K, V, Clock>::time_point*
+ExpiringMap<K, V, Clock>::deadline(const K& key) const {
+  const auto* node = data.find_node(Probe{key});
+  return node ? &node->data.deadline : nullptr;
+}
+
+template <class K, class V, class Clock>
+bool ExpiringMap<K, V, Clock>::remove(const K& key) {
+  const auto* node = data.find_node(Probe{key});
+  if (node == nullptr) return false;
+  deadlines.remove(Deadline{node->data.deadline, key});
+  return data.remove(Probe{key});
+}
+
+template <class K, class V, class Clock>
+std::size_t ExpiringMap<K, V, Clock>::expire(time_point now) {
+  std::size_t removed = 0;
+  while (deadlines.size() > 0) {
+    Deadline first = deadlines.select(0);
+    if (now < first.deadline) break;
+    deadlines.remove(first);
+    data.remove(Probe{first.key});
+    ++removed;
+  }
+  return removed;
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+/**
+ * @brief Gerador preguiçoso baseado em corrotinas (C++20).
+ *
+ * Produz os elementos sob demanda através de `co_yield`. A corrotina só
+ * avança quando o consumidor incrementa o iterador, de modo que é possível
+ * interromper a iteração a qualquer momento sem calcular os elementos
+ * restantes. Modela `std::ranges::input_range` e `std::ranges::view`, podendo
+ * ser combinado com as views da biblioteca padrão (`std::views::take`, etc.).
+ *
+ * Os elementos são entregues por referência constante ao objeto passado para
+ * `co_yield`; a referência é válida até o próximo incremento do iterador.
+ *
+ * @tparam T Tipo dos elementos produzidos.
+ */
+template <class T>
+class Generator : public std::ranges::view_interface<Generator<T>> {
+ public:
+  /**
+   * @brief Estado da corrotina exigido pelo compilador.
+   */
+  struct promise_type {
+    const T* current = nullptr;    ///< Elemento produzido mais recentemente.
+    std::exception_ptr exception;  ///< Exceção lançada pela corrotina.
+
+    Generator get_return_object() {
+      return Generator(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    std::suspend_always final_suspend() const noexcept { return {}; }
+
+    std::suspend_always yield_value(const T& value) noexcept {
+      current = std::addressof(value);
+      return {};
+    }
+
+    void return_void() const noexcept {}
+
+    void unhandled_exception() { exception = std::current_exception(); }
+
+    // Geradores não podem usar `co_await`.
+    template <class U>
+    std::suspend_never await_transform(U&&) = delete;
+  };
+
+  /**
+   * @brief Iterador de entrada sobre os elementos produzidos.
+   */
+  class iterator {
+   public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+
+    const T& operator*() const { return *handle.promise().current; }
+
+    const T* operator->() const { return handle.promise().current; }
+
+    iterator& operator++() {
+      handle.resume();
+      rethrow_if_failed();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const iterator& it, std::default_sentinel_t) {
+      return !it.handle || it.handle.done();
+    }
+
+   private:
+    friend class Generator;
+
+    explicit iterator(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+    void rethrow_if_failed() const {
+      if (handle.done() && handle.promise().exception) {
+        std::rethrow_exception(handle.promise().exception);
+      }
+    }
+
+    std::coroutine_handle<promise_type> handle;
+  };
+
+  Generator() = default;
+
+  Generator(Generator&& other) noexcept
+      : handle(std::exchange(other.handle, nullptr)) {}
+
+  Generator& operator=(Generator&& other) noexcept {
+    if (this != &other) {
+      if (handle) handle.destroy();
+      handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+  }
+
+  Generator(const Generator&) = delete;
+  Generator& operator=(const Generator&) = delete;
+
+  /**
+   * @brief Destrói a corrotina, mesmo que ela não tenha terminado.
+   */
+  ~Generator() {
+    if (handle) handle.destroy();
+  }
+
+  /**
+   * @brief Inicia a corrotina e retorna o iterador para o primeiro elemento.
+   *
+   * Deve ser chamado no máximo uma vez, pois o gerador é de passagem única.
+   */
+  iterator begin() {
+    iterator it(handle);
+    if (handle) {
+      handle.resume();
+      it.rethrow_if_failed();
+    }
+    return it;
+  }
+
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+ private:
+  explicit Generator(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+  std::coroutine_handle<promise_type> handle;
+};
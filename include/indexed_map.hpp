@@ -0,0 +1,401 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "avl.hpp"
+
+/**
+ * @brief Mapa associativo com índices secundários sobre os valores.
+ *
+ * Além da árvore principal (ordenada pela chave), mantém um índice para cada
+ * atributo declarado, extraído do valor por uma função informada na
+ * construção. Cada índice é uma árvore AVL de pares (atributo, nó), que é
+ * atualizada em toda atribuição via `operator[]` e em toda remoção. Como os
+ * nós da AVL não mudam de endereço em inserções e remoções, o índice aponta
+ * direto para o par chave-valor: contar os registros com um determinado
+ * atributo custa O(log n), e listá-los custa O(log n + m) para m resultados,
+ * sem nova busca na árvore principal.
+ *
+ * A cópia de um mapa reconstrói os índices sobre os nós da cópia.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam V Tipo do valor associado à chave.
+ * @tparam Attributes Tipos dos atributos indexados. Devem suportar '<'.
+ */
+template <class K, class V, class... Attributes>
+class IndexedMap {
+ private:
+  /**
+   * @brief Par chave-valor da árvore principal, ordenado pela chave.
+   */
+  struct Pair {
+    K key;    ///< A chave única.
+    V value;  ///< O valor associado.
+
+    explicit Pair(const K& k) : key(k), value() {}
+
+    bool operator<(const Pair& other) const { return key < other.key; }
+  };
+
+  /**
+   * @brief Chave de busca na árvore principal, sem construir um `V`.
+   */
+  struct Probe {
+    const K& key;  ///< A chave procurada.
+
+    friend bool operator<(const Pair& pair, const Probe& probe) {
+      return pair.key < probe.key;
+    }
+    friend bool operator<(const Probe& probe, const Pair& pair) {
+      return probe.key < pair.key;
+    }
+  };
+
+  /**
+   * @brief Índice secundário sobre um atributo do valor.
+   */
+  template <class A>
+  struct Index {
+    /**
+     * @brief Entrada do índice, ordenada por (atributo, chave).
+     *
+     * Entradas com `bound` diferente de zero não têm par e servem apenas de
+     * limite nas buscas: -1 precede e +1 sucede todas as entradas com o
+     * mesmo atributo.
+     */
+    struct Entry {
+      A attribute;                 ///< Atributo extraído do valor.
+      const Pair* pair = nullptr;  ///< Par no nó da árvore principal.
+      int bound = 0;               ///< Marca de limite (-1, 0 ou +1).
+
+      bool operator<(const Entry& other) const {
+        if (attribute < other.attribute) return true;
+        if (other.attribute < attribute) return false;
+        if (bound != other.bound) return bound < other.bound;
+        return bound == 0 && pair->key < other.pair->key;
+      }
+    };
+
+    std::function<A(const V&)> extract;  ///< Extrai o atributo do valor.
+    AVL<Entry> tree;                     ///< Pares (atributo, nó).
+  };
+
+ public:
+  /**
+   * @brief Referência a um valor do mapa devolvida por `operator[]`.
+   *
+   * Atribuir um novo valor por meio dela atualiza os índices secundários.
+   * É válida até a próxima alteração do mapa.
+   */
+  class Reference {
+   public:
+    /**
+     * @brief Substitui o valor, reindexando seus atributos.
+     */
+    Reference& operator=(const V& value) {
+      map.assign(*pair, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other) {
+      return *this = static_cast<const V&>(other);
+    }
+
+    operator const V&() const { return pair->value; }
+
+    /**
+     * @brief Retorna o valor atual.
+     */
+    const V& get() const { return pair->value; }
+
+   private:
+    friend class IndexedMap;
+
+    Reference(IndexedMap& m, Pair* p) : map(m), pair(p) {}
+
+    IndexedMap& map;  ///< Mapa ao qual o valor pertence.
+    Pair* pair;       ///< Par dentro do nó da árvore principal.
+  };
+
+  /**
+   * @brief Cria um mapa vazio com um índice para cada função informada.
+   *
+   * @param extractors Funções que extraem de um valor cada atributo
+   * indexado, na ordem de `Attributes`.
+   */
+  explicit IndexedMap(std::function<Attributes(const V&)>... extractors);
+
+  /**
+   * @brief Copia os pares e as funções de extração, reconstruindo os
+   * índices sobre os nós da cópia.
+   */
+  IndexedMap(const IndexedMap& other);
+  IndexedMap(IndexedMap&& other) noexcept;
+  IndexedMap& operator=(IndexedMap other) noexcept;
+
+  /**
+   * @brief Acessa o valor associado a uma chave.
+   *
+   * Se a chave não existir, insere um valor construído por padrão (e o
+   * indexa), como `Map::operator[]`.
+   *
+   * @param key A chave para buscar ou inserir.
+   * @return Referência que reindexa o valor quando recebe uma atribuição.
+   */
+  Reference operator[](const K& key);
+
+  /**
+   * @brief Acessa o valor associado a uma chave (versão constante).
+   *
+   * @throw std::out_of_range se a chave não for encontrada.
+   */
+  const V& operator[](const K& key) const;
+
+  /**
+   * @brief Remove a chave do mapa e dos índices.
+   *
+   * @return `true` se a chave existia.
+   */
+  bool remove(const K& key);
+
+  /**
+   * @brief Verifica se a chave está presente.
+   */
+  bool contain(const K& key) const;
+
+  /**
+   * @brief Retorna a quantidade de pares armazenados.
+   */
+  std::size_t size() const { return data.size(); }
+
+  /**
+   * @brief Retorna os pares cujo atributo `I` é igual a `attribute`.
+   *
+   * @tparam I Posição do índice em `Attributes`.
+   * @param attribute Valor do atributo procurado.
+   * @return Pares (chave, valor) em ordem crescente de chave.
+   */
+  template <std::size_t I>
+  std::vector<std::pair<K, V>> find_by(
+      const std::tuple_element_t<I, std::tuple<Attributes...>>& attribute)
+      const;
+
+  /**
+   * @brief Conta os pares cujo atributo `I` é igual a `attribute`, em
+   * O(log n).
+   *
+   * @tparam I Posição do índice em `Attributes`.
+   */
+  template <std::size_t I>
+  std::size_t count_by(
+      const std::tuple_element_t<I, std::tuple<Attributes...>>& attribute)
+      const;
+
+ private:
+  /**
+   * @brief Substitui o valor de `pair` por `value`, trocando as entradas
+   * dos índices.
+   *
+   * Se a extração de um atributo, uma inserção em um índice ou a atribuição
+   * do valor lançar exceção, o valor e os índices ficam como antes.
+   */
+  void assign(Pair& pair, const V& value);
+
+  /**
+   * @brief Adiciona `pair` a todos os índices.
+   *
+   * Se a extração de um atributo ou uma inserção lançar exceção, as
+   * entradas já inseridas são retiradas.
+   */
+  void index(const Pair& pair);
+
+  /**
+   * @brief Extrai de `value` uma entrada de cada índice apontando para
+   * `pair`.
+   */
+  auto entries(const Pair& pair, const V& value) const;
+
+  /**
+   * @brief Retira `pair` de todos os índices.
+   */
+  void unindex(const Pair& pair);
+
+  /**
+   * @brief Posições [início, fim) das entradas com o atributo no índice `I`.
+   */
+  template <std::size_t I, class A>
+  std::pair<std::size_t, std::size_t> equal_range(const A& attribute) const;
+
+  AVL<Pair> data;                            ///< Árvore principal.
+  std::tuple<Index<Attributes>...> indexes;  ///< Um índice por atributo.
+};
+
+template <class K, class V, class... Attributes>
+IndexedMap<K, V, Attributes...>::IndexedMap(
+    std::function<Attributes(const V&)>... extractors)
+    : indexes(Index<Attributes>{std::move(extractors), {}}...) {}
+
+template <class K, class V, class... Attributes>
+IndexedMap<K, V, Attributes...>::IndexedMap(const IndexedMap& other)
+    : data(other.data),
+      indexes(std::apply(
+          [](const auto&... idx) {
+            return std::tuple{Index<Attributes>{idx.extract, {}}...};
+          },
+          other.indexes)) {
+  // Os índices de `other` apontam para os nós dele
+  for (const Pair& pair : data.lazy_in_order()) index(pair);
+}
+
+template <class K, class V, class... Attributes>
+IndexedMap<K, V, Attributes...>::IndexedMap(IndexedMap&& other) noexcept
+    : data(std::move(other.data)), indexes(std::move(other.indexes)) {}
+
+template <class K, class V, class... Attributes>
+IndexedMap<K, V, Attributes...>& IndexedMap<K, V, Attributes...>::operator=(
+    IndexedMap other) noexcept {
+  std::swap(data, other.data);
+  std::swap(indexes, other.indexes);
+  return *this;
+}
+
+template <class K, class V, class... Attributes>
+typename IndexedMap<K, V, Attributes...>::Reference
+IndexedMap<K, V, Attributes...>::operator[](const K& key) {
+  auto* node = data.find_node(Probe{key});
+  if (node == nullptr) {
+    node = data.insert_or_find(Pair(key)).first;
+    try {
+      index(node->data);
+    } catch (...) {
+      data.remove(Probe{key});
+      throw;
+    }
+  }
+  return Reference(*this, &node->data);
+}
+
+template <class K, class V, class... Attributes>
+const V& IndexedMap<K, V, Attributes...>::operator[](const K& key) const {
+  const auto* node = data.find_node(Probe{key});
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found in map");
+  }
+  return node->data.value;
+}
+
+template <class K, class V, class... Attributes>
+bool IndexedMap<K, V, Attributes...>::remove(const K& key) {
+  const auto* node = data.find_node(Probe{key});
+  if (node == nullptr) return false;
+  unindex(node->data);
+  return data.remove(Probe{key});
+}
+
+template <class K, class V, class... Attributes>
+bool IndexedMap<K, V, Attributes...>::contain(const K& key) const {
+  return data.find_node(Probe{key}) != nullptr;
+}
+
+template <class K, class V, class... Attributes>
+template <std::size_t I>
+std::vector<std::pair<K, V>> IndexedMap<K, V, Attributes...>::find_by(
+    const std::tuple_element_t<I, std::tuple<Attributes...>>& attribute)
+    const {
+  using Entry = typename Index<
+      std::tuple_element_t<I, std::tuple<Attributes...>>>::Entry;
+  auto [first, last] = equal_range<I>(attribute);
+
+  std::vector<std::pair<K, V>> result;
+  result.reserve(last - first);
+  for (const Entry& entry : std::get<I>(indexes).tree.lazy_range(
+           {attribute, nullptr, -1}, {attribute, nullptr, +1})) {
+    result.emplace_back(entry.pair->key, entry.pair->value);
+  }
+  return result;
+}
+
+template <class K, class V, class... Attributes>
+template <std::size_t I>
+std::size_t IndexedMap<K, V, Attributes...>::count_by(
+    const std::tuple_element_t<I, std::tuple<Attributes...>>& attribute)
+    const {
+  auto [first, last] = equal_range<I>(attribute);
+  return last - first;
+}
+
+template <class K, class V, class... Attributes>
+auto IndexedMap<K, V, Attributes...>::entries(const Pair& pair,
+                                              const V& value) const {
+  return std::apply(
+      [&](const auto&... idx) {
+        return std::tuple{typename std::remove_cvref_t<decltype(idx)>::Entry{
+            idx.extract(value), &pair}...};
+      },
+      indexes);
+}
+
+template <class K, class V, class... Attributes>
+void IndexedMap<K, V, Attributes...>::assign(Pair& pair, const V& value) {
+  // Extrai os atributos antes de alterar qualquer coisa
+  auto before = entries(pair, pair.value);
+  auto after = entries(pair, value);
+
+  std::array<bool, sizeof...(Attributes)> added{};
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    try {
+      // As entradas novas entram antes da troca, e as antigas continuam
+      // válidas até ela; uma entrada igual à antiga não é inserida
+      ((added[I] = std::get<I>(indexes).tree.insert(std::get<I>(after))),
+       ...);
+      pair.value = value;
+    } catch (...) {
+      ((added[I] ? void(std::get<I>(indexes).tree.remove(std::get<I>(after)))
+                 : void()),
+       ...);
+      throw;
+    }
+    ((added[I] ? void(std::get<I>(indexes).tree.remove(std::get<I>(before)))
+               : void()),
+     ...);
+  }(std::index_sequence_for<Attributes...>{});
+}
+
+template <class K, class V, class... Attributes>
+void IndexedMap<K, V, Attributes...>::index(const Pair& pair) {
+  auto fresh = entries(pair, pair.value);
+  std::array<bool, sizeof...(Attributes)> added{};
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    try {
+      ((added[I] = std::get<I>(indexes).tree.insert(std::get<I>(fresh))), ...);
+    } catch (...) {
+      ((added[I] ? void(std::get<I>(indexes).tree.remove(std::get<I>(fresh)))
+                 : void()),
+       ...);
+      throw;
+    }
+  }(std::index_sequence_for<Attributes...>{});
+}
+
+template <class K, class V, class... Attributes>
+void IndexedMap<K, V, Attributes...>::unindex(const Pair& pair) {
+  std::apply(
+      [&](auto&... idx) {
+        (idx.tree.remove({idx.extract(pair.value), &pair}), ...);
+      },
+      indexes);
+}
+
+template <class K, class V, class... Attributes>
+template <std::size_t I, class A>
+std::pair<std::size_t, std::size_t>
+IndexedMap<K, V, Attributes...>::equal_range(const A& attribute) const {
+  const auto& tree = std::get<I>(indexes).tree;
+  return {tree.rank({attribute, nullptr, -1}),
+          tree.rank({attribute, nullptr, +1})};
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Codificação de um tipo em bytes que preserva a ordem.
+ *
+ * Para dois valores `a` e `b`, `a < b` se e somente se a codificação de `a`
+ * precede a de `b` na comparação byte a byte (como `memcmp`, que é a ordem de
+ * `std::string`). Codificações de partes podem ser concatenadas: a de uma
+ * tupla é a concatenação das de seus campos, e compará-las equivale à ordem
+ * lexicográfica da tupla.
+ *
+ * Especializações disponíveis: `bool`, inteiros, `float`, `double`,
+ * `std::string` e tuplas/pares desses tipos.
+ *
+ * @tparam T Tipo codificado.
+ */
+template <class T>
+struct KeyCodec;
+
+/**
+ * @brief Booleanos: um byte, 0 ou 1.
+ */
+template <>
+struct KeyCodec<bool> {
+  static void encode(std::string& out, bool value) {
+    out.push_back(value ? 1 : 0);
+  }
+
+  static bool decode(std::string_view& in) {
+    if (in.empty()) throw std::invalid_argument("Truncated key encoding");
+    bool value = in.front() != 0;
+    in.remove_prefix(1);
+    return value;
+  }
+};
+
+/**
+ * @brief Inteiros: largura fixa em big-endian. Nos inteiros com sinal o bit
+ * de sinal é invertido, para que os negativos precedam os positivos.
+ */
+template <std::integral T>
+  requires(!std::same_as<T, bool>)
+struct KeyCodec<T> {
+  using Bits = std::make_unsigned_t<T>;
+
+  static constexpr Bits sign_bit() {
+    return std::is_signed_v<T> ? Bits(Bits(1) << (sizeof(T) * 8 - 1))
+                               : Bits(0);
+  }
+
+  static void encode(std::string& out, T value) {
+    Bits bits = static_cast<Bits>(value) ^ sign_bit();
+    for (int shift = static_cast<int>(sizeof(T) - 1) * 8; shift >= 0;
+         shift -= 8) {
+      out.push_back(static_cast<char>(bits >> shift));
+    }
+  }
+
+  static T decode(std::string_view& in) {
+    if (in.size() < sizeof(T)) {
+      throw std::invalid_argument("Truncated key encoding");
+    }
+    Bits bits = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      unsigned char byte = static_cast<unsigned char>(in[i]);
+      bits = static_cast<Bits>((bits << 8) | byte);
+    }
+    in.remove_prefix(sizeof(T));
+    return static_cast<T>(bits ^ sign_bit());
+  }
+};
+
+/**
+ * @brief Ponto flutuante: bits IEEE 754 em big-endian. Nos positivos o bit de
+ * sinal é ligado; nos negativos todos os bits são invertidos, o que inverte
+ * também a ordem das magnitudes.
+ *
+ * `-0.0` é codificado como `0.0` (os dois são iguais por '<'). NaNs ficam
+ * depois de `+inf` (ou antes de `-inf`, se o bit de sinal estiver ligado).
+ */
+template <std::floating_point T>
+  requires(sizeof(T) == 4 || sizeof(T) == 8)
+struct KeyCodec<T> {
+  using Bits =
+      std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+  static constexpr Bits sign_bit = Bits(1) << (sizeof(T) * 8 - 1);
+
+  static void encode(std::string& out, T value) {
+    if (value == 0) value = 0;  // Normaliza -0.0
+    Bits bits = std::bit_cast<Bits>(value);
+    bits = (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    KeyCodec<Bits>::encode(out, bits);
+  }
+
+  static T decode(std::string_view& in) {
+    Bits bits = KeyCodec<Bits>::decode(in);
+    bits = (bits & sign_bit) ? (bits ^ sign_bit) : ~bits;
+    return std::bit_cast<T>(bits);
+  }
+};
+
+/**
+ * @brief Strings: os bytes com escape, seguidos de um terminador.
+ *
+ * Cada byte 0x00 vira 0x00 0xFF, e a string termina com 0x00 0x01. Assim uma
+ * string sempre precede as que a estendem, mesmo quando seguida de outras
+ * partes, e bytes nulos no conteúdo são preservados.
+ */
+template <>
+struct KeyCodec<std::string> {
+  static void encode(std::string& out, std::string_view value) {
+    for (char c : value) {
+      out.push_back(c);
+      if (c == '\0') out.push_back('\xff');
+    }
+    out.push_back('\0');
+    out.push_back('\x01');
+  }
+
+  static std::string decode(std::string_view& in) {
+    std::string value;
+    for (std::size_t i = 0; i + 1 < in.size(); ++i) {
+      if (in[i] != '\0') {
+        value.push_back(in[i]);
+      } else if (in[i + 1] == '\xff') {
+        value.push_back('\0');
+        ++i;
+      } else if (in[i + 1] == '\x01') {
+        in.remove_prefix(i + 2);
+        return value;
+      } else {
+        break;
+      }
+    }
+    throw std::invalid_argument("Malformed string in key encoding");
+  }
+};
+
+/**
+ * @brief Tuplas: concatenação das codificações dos campos, em ordem.
+ */
+template <class... Ts>
+struct KeyCodec<std::tuple<Ts...>> {
+  static void encode(std::string& out, const std::tuple<Ts...>& value) {
+    std::apply(
+        [&out](const Ts&... parts) {
+          (KeyCodec<Ts>::encode(out, parts), ...);
+        },
+        value);
+  }
+
+  static std::tuple<Ts...> decode(std::string_view& in) {
+    // A inicialização com chaves avalia os campos da esquerda para a direita
+    return std::tuple<Ts...>{KeyCodec<Ts>::decode(in)...};
+  }
+};
+
+template <class A, class B>
+struct KeyCodec<std::pair<A, B>> {
+  static void encode(std::string& out, const std::pair<A, B>& value) {
+    KeyCodec<A>::encode(out, value.first);
+    KeyCodec<B>::encode(out, value.second);
+  }
+
+  static std::pair<A, B> decode(std::string_view& in) {
+    A first = KeyCodec<A>::decode(in);
+    B second = KeyCodec<B>::decode(in);
+    return {std::move(first), std::move(second)};
+  }
+};
+
+/**
+ * @brief Tipo cujo `KeyCodec` codifica um argumento do tipo `T`: textos
+ * (`const char*`, `std::string_view`, literais) usam o de `std::string`.
+ */
+template <class T>
+using KeyCodecFor =
+    std::conditional_t<std::is_convertible_v<const T&, std::string_view>,
+                       KeyCodec<std::string>,
+                       KeyCodec<std::remove_cvref_t<T>>>;
+
+/**
+ * @brief Codifica uma chave composta em bytes que preservam a ordem.
+ *
+ * O resultado pode ser usado como chave de um `Map<std::string, V>`: a ordem
+ * das chaves codificadas é a ordem lexicográfica das partes, e cada
+ * comparação na árvore é uma única comparação de bytes.
+ *
+ * @param parts Partes da chave, da mais para a menos significativa.
+ * @return Os bytes da chave.
+ */
+template <class... Parts>
+std::string encode_key(const Parts&... parts) {
+  std::string out;
+  (KeyCodecFor<Parts>::encode(out, parts), ...);
+  return out;
+}
+
+/**
+ * @brief Decodifica uma chave produzida por `encode_key`.
+ *
+ * @tparam T Tipo da chave; uma `std::tuple` para chaves compostas.
+ * @param bytes Os bytes da chave.
+ * @return O valor decodificado.
+ * @throw std::invalid_argument se os bytes não forem uma codificação
+ * completa de `T`.
+ */
+template <class T>
+T decode_key(std::string_view bytes) {
+  T value = KeyCodec<T>::decode(bytes);
+  if (!bytes.empty()) {
+    throw std::invalid_argument("Trailing bytes in key encoding");
+  }
+  return value;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Prefixo de uma chave guardado no nó ao lado da própria chave.
+ *
+ * Para tipos sem prefixo (o caso geral) é um objeto vazio, que não ocupa
+ * espaço quando declarado com `[[no_unique_address]]`, e todas as chaves
+ * têm o "mesmo" prefixo, de modo que a comparação recai sempre no operador
+ * '<' das chaves.
+ *
+ * Uso: compare os prefixos primeiro e, somente se forem iguais, as chaves.
+ *
+ * @tparam K Tipo da chave.
+ */
+template <class K>
+struct KeyPrefix {
+  KeyPrefix() = default;
+
+  template <class Q>
+  explicit KeyPrefix(const Q&) {}
+
+  bool operator==(const KeyPrefix&) const { return true; }
+  bool operator<(const KeyPrefix&) const { return false; }
+};
+
+/**
+ * @brief Prefixo de chaves de texto: os 8 primeiros bytes, em big-endian.
+ *
+ * Comparar os prefixos como inteiros equivale a comparar os 8 primeiros
+ * bytes das strings (como `unsigned char`, a mesma ordem de
+ * `std::string::operator<`). Quando os prefixos diferem, a comparação das
+ * chaves está decidida sem acessar o buffer da string; strings mais curtas
+ * são completadas com zeros, então prefixos iguais exigem a comparação
+ * completa.
+ *
+ * Só vale para `std::string` e `std::string_view`, cujo '<' é a ordem dos
+ * bytes. Outros tipos conversíveis em texto (`const char*`, chaves com '<'
+ * próprio, como comparações sem distinção de maiúsculas) usam o caso geral,
+ * para que a ordem do mapa continue sendo a do '<' da chave.
+ */
+template <class K>
+  requires std::same_as<K, std::string> || std::same_as<K, std::string_view>
+struct KeyPrefix<K> {
+  std::uint64_t value = 0;  ///< Primeiros bytes da chave, em big-endian.
+
+  KeyPrefix() = default;
+
+  explicit KeyPrefix(std::string_view key) : value(encode(key)) {}
+
+  bool operator==(const KeyPrefix&) const = default;
+  bool operator<(const KeyPrefix& other) const { return value < other.value; }
+
+  /**
+   * @brief Monta o inteiro com os primeiros bytes de `key`, o primeiro byte
+   * no octeto mais significativo.
+   */
+  static std::uint64_t encode(std::string_view key) {
+    unsigned char bytes[sizeof(std::uint64_t)] = {};
+    if (!key.empty()) {
+      std::memcpy(bytes, key.data(),
+                  key.size() < sizeof(bytes) ? key.size() : sizeof(bytes));
+    }
+    std::uint64_t result = 0;
+    for (unsigned char byte : bytes) {
+      result = (result << 8) | byte;
+    }
+    return result;
+  }
+};
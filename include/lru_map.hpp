@@ -0,0 +1,317 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "avl.hpp"
+
+/**
+ * @brief Cache ordenado com descarte do item usado há mais tempo (LRU).
+ *
+ * As entradas ficam em uma árvore AVL ordenada pela chave, e cada uma
+ * carrega também ponteiros intrusivos para a anterior e a próxima na ordem de
+ * uso. Como os nós da AVL não mudam de endereço em inserções e remoções, a
+ * lista de uso dispensa alocações próprias: a busca custa O(log n) e mover
+ * uma entrada para o início da lista custa O(1).
+ *
+ * O limite do cache é expresso em peso: por padrão cada entrada pesa 1 (o
+ * limite é a quantidade de entradas), mas uma função de peso pode ser usada
+ * para limitar, por exemplo, a memória ocupada pelos valores.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam V Tipo do valor associado à chave.
+ */
+template <class K, class V>
+class LruMap {
+ public:
+  /// Função que calcula o peso de uma entrada.
+  using Weigher = std::function<std::size_t(const K&, const V&)>;
+
+ private:
+  /**
+   * @brief Entrada do cache: nó da árvore e elo da lista de uso.
+   */
+  struct Entry {
+    K key;                   ///< A chave única.
+    V value;                 ///< O valor associado.
+    std::size_t weight;      ///< Peso contabilizado no limite.
+    Entry* newer = nullptr;  ///< Entrada usada logo depois desta.
+    Entry* older = nullptr;  ///< Entrada usada logo antes desta.
+
+    Entry(const K& k, const V& v, std::size_t w)
+        : key(k), value(v), weight(w) {}
+
+    bool operator<(const Entry& other) const { return key < other.key; }
+  };
+
+  /**
+   * @brief Chave de busca na árvore, sem construir um `V`.
+   */
+  struct Probe {
+    const K& key;  ///< A chave procurada.
+
+    friend bool operator<(const Entry& entry, const Probe& probe) {
+      return entry.key < probe.key;
+    }
+    friend bool operator<(const Probe& probe, const Entry& entry) {
+      return probe.key < entry.key;
+    }
+  };
+
+ public:
+  /**
+   * @brief Cria um cache limitado pela quantidade de entradas.
+   *
+   * @param capacity Quantidade máxima de entradas.
+   */
+  explicit LruMap(std::size_t capacity);
+
+  /**
+   * @brief Cria um cache limitado pela soma dos pesos das entradas.
+   *
+   * @param budget Peso total máximo.
+   * @param weigh Função que calcula o peso de cada entrada.
+   */
+  LruMap(std::size_t budget, Weigher weigh);
+
+  LruMap(const LruMap& other);
+  LruMap(LruMap&& other) noexcept;
+  LruMap& operator=(LruMap other) noexcept;
+
+  /**
+   * @brief Busca o valor de uma chave e a marca como a mais recente.
+   *
+   * @param key A chave.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir.
+   */
+  const V* get(const K& key);
+
+  /**
+   * @brief Busca o valor de uma chave sem alterar a ordem de uso.
+   *
+   * @param key A chave.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir.
+   */
+  const V* peek(const K& key) const;
+
+  /**
+   * @brief Associa `value` à chave e a marca como a mais recente.
+   *
+   * Em seguida descarta as entradas usadas há mais tempo até que o peso
+   * total respeite o limite. Uma entrada mais pesada que o próprio limite é
+   * descartada imediatamente.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   * @return Quantidade de entradas descartadas.
+   */
+  std::size_t put(const K& key, const V& value);
+
+  /**
+   * @brief Remove uma chave do cache.
+   *
+   * @return `true` se a chave existia.
+   */
+  bool remove(const K& key);
+
+  /**
+   * @brief Remove as chaves do intervalo [first, last).
+   *
+   * @return Quantidade de entradas removidas.
+   */
+  std::size_t remove_range(const K& first, const K& last);
+
+  /**
+   * @brief Retorna a quantidade de entradas.
+   */
+  std::size_t size() const { return data.size(); }
+
+  /**
+   * @brief Retorna a soma dos pesos das entradas.
+   */
+  std::size_t weight() const { return used; }
+
+  /**
+   * @brief Retorna o peso total máximo.
+   */
+  std::size_t limit() const { return budget; }
+
+  /**
+   * @brief Retorna as entradas da mais recente para a mais antiga.
+   */
+  std::vector<std::pair<K, V>> recency_order() const;
+
+ private:
+  /**
+   * @brief Insere a entrada no início da lista de uso.
+   */
+  void push_front(Entry* entry);
+
+  /**
+   * @brief Retira a entrada da lista de uso.
+   */
+  void unlink(Entry* entry);
+
+  /**
+   * @brief Retira a entrada da lista e da árvore.
+   */
+  void erase(Entry* entry);
+
+  /**
+   * @brief Descarta as entradas mais antigas até respeitar o limite.
+   *
+   * @return Quantidade de entradas descartadas.
+   */
+  std::size_t evict();
+
+  AVL<Entry> data;          ///< Entradas ordenadas pela chave.
+  Entry* newest = nullptr;  ///< Início da lista de uso.
+  Entry* oldest = nullptr;  ///< Fim da lista de uso.
+  std::size_t budget;       ///< Peso total máximo.
+  std::size_t used = 0;     ///< Peso total atual.
+  Weigher weigh;            ///< Calcula o peso de uma entrada.
+};
+
+template <class K, class V>
+LruMap<K, V>::LruMap(std::size_t capacity)
+    : LruMap(capacity, [](const K&, const V&) -> std::size_t { return 1; }) {}
+
+template <class K, class V>
+LruMap<K, V>::LruMap(std::size_t budget, Weigher weigh)
+    : budget(budget), weigh(std::move(weigh)) {}
+
+template <class K, class V>
+LruMap<K, V>::LruMap(const LruMap& other)
+    : budget(other.budget), weigh(other.weigh) {
+  // Reinsere da mais antiga para a mais recente, reconstruindo a lista
+  for (const Entry* entry = other.oldest; entry; entry = entry->newer) {
+    auto* node = data.insert_or_find(*entry).first;
+    node->data.newer = node->data.older = nullptr;
+    push_front(&node->data);
+  }
+  used = other.used;
+}
+
+template <class K, class V>
+LruMap<K, V>::LruMap(LruMap&& other) noexcept
+    : data(std::move(other.data)),
+      newest(std::exchange(other.newest, nullptr)),
+      oldest(std::exchange(other.oldest, nullptr)),
+      budget(other.budget),
+      used(std::exchange(other.used, 0)),
+      weigh(std::move(other.weigh)) {}
+
+template <class K, class V>
+LruMap<K, V>& LruMap<K, V>::operator=(LruMap other) noexcept {
+  std::swap(data, other.data);
+  std::swap(newest, other.newest);
+  std::swap(oldest, other.oldest);
+  std::swap(budget, other.budget);
+  std::swap(used, other.used);
+  std::swap(weigh, other.weigh);
+  return *this;
+}
+
+template <class K, class V>
+const V* LruMap<K, V>::get(const K& key) {
+  auto* node = data.find_node(Probe{key});
+  if (node == nullptr) return nullptr;
+  unlink(&node->data);
+  push_front(&node->data);
+  return &node->data.value;
+}
+
+template <class K, class V>
+const V* LruMap<K, V>::peek(const K& key) const {
+  const auto* node = data.find_node(Probe{key});
+  return node ? &node->data.value : nullptr;
+}
+
+template <class K, class V>
+std::size_t LruMap<K, V>::put(const K& key, const V& value) {
+  std::size_t weight = weigh(key, value);
+  Entry* entry;
+  if (auto* node = data.find_node(Probe{key})) {
+    entry = &node->data;
+    // Atribui antes de mexer na lista: se lançar, nada mudou
+    entry->value = value;
+    used = used - entry->weight + weight;
+    entry->weight = weight;
+    unlink(entry);
+  } else {
+    entry = &data.insert_or_find(Entry(key, value, weight)).first->data;
+    used += weight;
+  }
+  push_front(entry);
+  return evict();
+}
+
+template <class K, class V>
+bool LruMap<K, V>::remove(const K& key) {
+  auto* node = data.find_node(Probe{key});
+  if (node == nullptr) return false;
+  erase(&node->data);
+  return true;
+}
+
+template <class K, class V>
+std::size_t LruMap<K, V>::remove_range(const K& first, const K& last) {
+  if (!(first < last)) return 0;
+  std::size_t begin = data.rank(Probe{first});
+  std::size_t end = data.rank(Probe{last});
+  std::vector<K> keys;
+  keys.reserve(end - begin);
+  for (std::size_t i = begin; i < end; ++i) {
+    keys.push_back(data.select(i).key);
+  }
+  for (const K& key : keys) {
+    remove(key);
+  }
+  return keys.size();
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> LruMap<K, V>::recency_order() const {
+  std::vector<std::pair<K, V>> result;
+  result.reserve(size());
+  for (const Entry* entry = newest; entry; entry = entry->older) {
+    result.emplace_back(entry->key, entry->value);
+  }
+  return result;
+}
+
+template <class K, class V>
+void LruMap<K, V>::push_front(Entry* entry) {
+  entry->older = newest;
+  entry->newer = nullptr;
+  if (newest) newest->newer = entry;
+  newest = entry;
+  if (oldest == nullptr) oldest = entry;
+}
+
+template <class K, class V>
+void LruMap<K, V>::unlink(Entry* entry) {
+  (entry->newer ? entry->newer->older : newest) = entry->older;
+  (entry->older ? entry->older->newer : oldest) = entry->newer;
+  entry->newer = entry->older = nullptr;
+}
+
+template <class K, class V>
+void LruMap<K, V>::erase(Entry* entry) {
+  unlink(entry);
+  used -= entry->weight;
+  // A remoção libera apenas o nó desta entrada, depois da última comparação
+  // com a chave
+  data.remove(Probe{entry->key});
+}
+
+template <class K, class V>
+std::size_t LruMap<K, V>::evict() {
+  std::size_t evicted = 0;
+  while (used > budget && oldest != nullptr) {
+    erase(oldest);
+    ++evicted;
+  }
+  return evicted;
+}
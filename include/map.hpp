@@ -1,12 +1,20 @@
 #pragma once
-#include "bst.hpp"
+#include "avl.hpp"
+#include "key_prefix.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
 #include <stdexcept> // Para std::out_of_range
+#include <utility>
+#include <vector>
 
 /**
  * @brief Classe que representa um Mapa Associativo (Map).
  *
  * Armazena pares chave-valor, onde cada chave é única. A ordenação e
- * busca são garantidas pelo uso de uma Árvore Binária.
+ * busca são garantidas pelo uso de uma Árvore AVL.
  *
  * @tparam K Tipo da chave. Deve suportar o operadores de comparação '<'.
  * @tparam V Tipo do valor associado à chave.
@@ -22,12 +30,21 @@ class Map {
     K key;    ///< A chave única.
     V value;  ///< Ponteiro para o valor. O Map gerenciará a memória deste
               ///< valor.
+    /// Prefixo da chave (apenas para chaves de texto; vazio nos demais).
+    [[no_unique_address]] KeyPrefix<K> prefix;
 
     /**
      * @brief Construtor do Pair com uma chave.
      * @param k A chave.
      */
-    explicit Pair(const K& k) : key(k), value() {}
+    explicit Pair(const K& k) : key(k), value(), prefix(key) {}
+
+    /**
+     * @brief Construtor do Pair com chave e valor.
+     * @param k A chave.
+     * @param v O valor.
+     */
+    Pair(const K& k, const V& v) : key(k), value(v), prefix(key) {}
 
     /**
      * @brief Operador de comparação 'menor que'.
@@ -35,18 +52,70 @@ class Map {
      * **Importante:** Esta comparação DEVE ser baseada apenas na `key`
      * para que o mapa funcione corretamente.
      *
+     * Prefixos diferentes já decidem a comparação, sem acessar a chave.
+     *
      * @param other O outro Pair para comparar.
      * @return `true` se este Pair for considerado menor que `other` (baseado na
      * chave), `false` caso contrário.
      */
     bool operator<(const Pair& other) const {
-      // A comparação é invertida para corresponder à ordem dos testes.
-      // Se os testes esperassem ordem crescente, seria: return key < other.key;
-      return key > other.key;
+      if (!(prefix == other.prefix)) return prefix < other.prefix;
+      return key < other.key;
+    }
+
+    /**
+     * @brief Comparações com uma chave avulsa (`K` ou um tipo comparável
+     * com `K`), usadas nas buscas para não construir um Pair.
+     */
+    template <class Q>
+      requires(!std::same_as<Q, Pair> && LessComparableWith<Q, K>)
+    friend bool operator<(const Pair& pair, const Q& key) {
+      return pair.key < key;
+    }
+
+    template <class Q>
+      requires(!std::same_as<Q, Pair> && LessComparableWith<Q, K>)
+    friend bool operator<(const Q& key, const Pair& pair) {
+      return key < pair.key;
+    }
+  };
+
+  /**
+   * @brief Chave de busca com o prefixo já calculado, para que cada nível da
+   * descida compare primeiro os prefixos (como em `Pair::operator<`).
+   */
+  template <class Q>
+  struct Lookup {
+    const Q& key;         ///< A chave procurada.
+    KeyPrefix<K> prefix;  ///< Prefixo de `key`.
+
+    friend bool operator<(const Pair& pair, const Lookup& lookup) {
+      if (!(pair.prefix == lookup.prefix)) return pair.prefix < lookup.prefix;
+      return pair.key < lookup.key;
+    }
+
+    friend bool operator<(const Lookup& lookup, const Pair& pair) {
+      if (!(lookup.prefix == pair.prefix)) return lookup.prefix < pair.prefix;
+      return lookup.key < pair.key;
     }
   };
 
+  /**
+   * @brief Prepara `key` para uma busca na árvore: com o prefixo calculado
+   * uma única vez, ou a própria chave se o prefixo não puder ser obtido dela.
+   */
+  template <class Q>
+  static decltype(auto) lookup(const Q& key) {
+    if constexpr (std::constructible_from<KeyPrefix<K>, const Q&>) {
+      return Lookup<Q>{key, KeyPrefix<K>(key)};
+    } else {
+      return (key);
+    }
+  }
+
  public:
+  class Transaction;
+
   /**
    * @brief Construtor padrão.
    * Cria um mapa vazio.
@@ -65,6 +134,20 @@ class Map {
    */
   V& operator[](const K& key);
 
+  /**
+   * @brief Acessa o valor associado a uma chave de outro tipo (por exemplo,
+   * `std::string_view` em um `Map<std::string, V>`).
+   *
+   * A busca não constrói um `K`; só se a chave não existir é que um `K` é
+   * construído a partir de `key` e inserido com o valor padrão.
+   *
+   * @param key Chave comparável com `K` pelo operador '<'.
+   * @return Uma referência ao valor associado à chave.
+   */
+  template <HeterogeneousKey<K> Q>
+    requires std::constructible_from<K, const Q&>
+  V& operator[](const Q& key);
+
   /**
    * @brief Acessa o valor associado a uma chave (versão constante).
    *
@@ -76,6 +159,15 @@ class Map {
    */
   const V& operator[](const K& key) const;
 
+  /**
+   * @brief Acessa o valor associado a uma chave de outro tipo, sem construir
+   * um `K` (versão constante).
+   *
+   * @throw std::out_of_range se a chave não for encontrada.
+   */
+  template <HeterogeneousKey<K> Q>
+  const V& operator[](const Q& key) const;
+
   /**
    * @brief Remove um par chave-valor do mapa.
    *
@@ -87,32 +179,396 @@ class Map {
    */
   bool remove(const K& key);
 
+  /**
+   * @brief Remove o par cuja chave é equivalente a uma chave de outro tipo,
+   * sem construir um `K`.
+   *
+   * @return `true` se o elemento foi encontrado e removido.
+   */
+  template <HeterogeneousKey<K> Q>
+  bool remove(const Q& key);
+
+  /**
+   * @brief Remove um par apenas marcando o seu nó, sem rotações.
+   *
+   * Indicado para rajadas de remoções: as marcas são descartadas em lote
+   * quando superam os pares presentes, ou por `purge`.
+   *
+   * @param key A chave do elemento a ser removido.
+   * @return `true` se o elemento foi encontrado e removido.
+   */
+  bool remove_lazy(const K& key);
+
+  /**
+   * @brief Descarta as marcas deixadas por `remove_lazy`, em O(n).
+   */
+  void purge();
+
+  /**
+   * @brief Retorna a quantidade de pares armazenados.
+   *
+   * @return Número de chaves no mapa.
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Exporta os pares em ordem crescente de chave para um vetor
+   * pré-alocado, usando várias threads.
+   *
+   * @param out Região de saída com pelo menos `size()` posições.
+   * @throw std::out_of_range se `out` for menor que o mapa.
+   */
+  void parallel_in_order(std::span<std::pair<K, V>> out) const;
+
+  /**
+   * @brief Aplica `visit` a todos os pares, em paralelo e em ordem não
+   * especificada.
+   *
+   * @param visit Função `void(const K&, const V&)` segura para uso
+   * concorrente.
+   */
+  template <class Visitor>
+  void parallel_for_each(Visitor visit) const;
+
+  /**
+   * @brief Reduz, em paralelo, os pares transformados por `mapper`.
+   *
+   * @param identity Elemento neutro de `reducer`.
+   * @param mapper Função `R(const K&, const V&)`.
+   * @param reducer Função `R(R, R)` associativa.
+   * @return Resultado da redução.
+   */
+  template <class R, class Mapper, class Reducer>
+  R parallel_reduce(R identity, Mapper mapper, Reducer reducer) const;
+
+  /**
+   * @brief Retorna um novo mapa com os pares que satisfazem `pred`.
+   *
+   * O mapa resultante é construído já balanceado, sem reinserções.
+   *
+   * @param pred Predicado `bool(const K&, const V&)` seguro para uso
+   * concorrente.
+   * @return Mapa filtrado.
+   */
+  template <class Predicate>
+  Map filter(Predicate pred) const;
+
+  /**
+   * @brief Insere vários pares chave-valor de uma só vez.
+   *
+   * O lote é ordenado por chave e unido à árvore em uma única passada, em
+   * vez de uma descida por chave. Chaves já presentes mantêm o valor atual;
+   * se uma chave se repetir no lote, vale a primeira ocorrência.
+   *
+   * @param entries Intervalo de `std::pair<K, V>` (ou conversível).
+   * @return Quantidade de chaves efetivamente inseridas.
+   */
+  template <class Range>
+  std::size_t insert_batch(const Range& entries);
+
+  /**
+   * @brief Remove várias chaves de uma só vez.
+   *
+   * @param keys Intervalo de chaves a remover.
+   * @return Quantidade de chaves efetivamente removidas.
+   */
+  template <class Range>
+  std::size_t remove_batch(const Range& keys);
+
+  /**
+   * @brief Inicia uma transação sobre o mapa.
+   *
+   * As escritas e remoções feitas pela transação ficam em um buffer e só
+   * são aplicadas ao mapa em `Transaction::commit`, todas de uma vez. Se a
+   * transação for destruída sem `commit` (por exemplo, porque uma exceção
+   * interrompeu as atualizações), nada é aplicado.
+   *
+   * @return Transação vinculada a este mapa.
+   */
+  Transaction transaction();
+
+  /**
+   * @brief Insere a chave com `value` ou, se ela já existir, combina o valor
+   * atual com `value`, em uma única descida na árvore.
+   *
+   * Substitui o padrão `m[k] = m[k] + v`, que faz duas buscas.
+   *
+   * @param key A chave.
+   * @param value O valor a inserir ou combinar.
+   * @param combine Função `V(const V& atual, const V& novo)`.
+   * @return `true` se a chave foi inserida, `false` se foi combinada.
+   */
+  template <class Combine>
+  bool upsert(const K& key, const V& value, Combine combine);
+
+  /**
+   * @brief Aplica `upsert` a um lote de pares de uma só vez.
+   *
+   * O lote é ordenado por chave e as repetições são combinadas entre si
+   * (na ordem em que aparecem) antes de o lote ser unido à árvore em uma
+   * única passada de divisão e junção.
+   *
+   * @param entries Intervalo de `std::pair<K, V>` (ou conversível).
+   * @param combine Função `V(const V& atual, const V& novo)`. Pode ser
+   * chamada em paralelo para chaves distintas.
+   * @return Quantidade de chaves novas inseridas.
+   */
+  template <class Range, class Combine>
+  std::size_t upsert_batch(const Range& entries, Combine combine);
+
+  /**
+   * @brief Incorpora todos os pares de outro mapa, combinando os valores das
+   * chaves presentes nos dois.
+   *
+   * @param other Mapa de origem (não é modificado).
+   * @param combine Função `V(const V& atual, const V& de_other)`.
+   * @return Quantidade de chaves novas inseridas.
+   */
+  template <class Combine>
+  std::size_t merge_from(const Map& other, Combine combine);
+
+  /**
+   * @brief Retorna os `k` pares de maiores chaves, em ordem decrescente de
+   * chave, em O(k + log n).
+   *
+   * @param k Quantidade de pares desejados.
+   * @return Os `min(k, size())` pares com as maiores chaves.
+   */
+  std::vector<std::pair<K, V>> top_k(std::size_t k) const;
+
+  /**
+   * @brief Retorna os `k` pares de menores chaves, em ordem crescente de
+   * chave, em O(k + log n).
+   *
+   * @param k Quantidade de pares desejados.
+   * @return Os `min(k, size())` pares com as menores chaves.
+   */
+  std::vector<std::pair<K, V>> bottom_k(std::size_t k) const;
+
+  /**
+   * @brief Retorna os `k` pares de maiores valores, em ordem decrescente de
+   * valor (empates pela menor chave).
+   *
+   * Como `operator[]` permite alterar os valores diretamente, a árvore não
+   * mantém um índice por valor: a consulta percorre todos os pares mantendo
+   * apenas os `k` melhores, em O(n log k). `V` deve suportar o operador '<'.
+   *
+   * @param k Quantidade de pares desejados.
+   * @return Os `min(k, size())` pares com os maiores valores.
+   */
+  std::vector<std::pair<K, V>> top_k_by_value(std::size_t k) const;
+
+  /**
+   * @brief Retorna os `k` pares de menores valores, em ordem crescente de
+   * valor (empates pela menor chave), em O(n log k).
+   *
+   * @param k Quantidade de pares desejados.
+   * @return Os `min(k, size())` pares com os menores valores.
+   */
+  std::vector<std::pair<K, V>> bottom_k_by_value(std::size_t k) const;
+
+  /**
+   * @brief Sorteia um par uniformemente, em O(log n).
+   *
+   * @return Cópia do par sorteado.
+   * @throw std::out_of_range se o mapa estiver vazio.
+   */
+  std::pair<K, V> sample() const;
+
+  /**
+   * @brief Sorteia `k` pares distintos uniformemente, em O(k log n).
+   *
+   * @param k Quantidade de pares (limitada a `size()`).
+   * @return Os pares sorteados, em ordem crescente de chave.
+   */
+  std::vector<std::pair<K, V>> sample(std::size_t k) const;
+
+  /**
+   * @brief Versão de `sample()` com gerador de bits aleatórios explícito.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  std::pair<K, V> sample(URBG& gen) const;
+
+  /**
+   * @brief Versão de `sample(k)` com gerador de bits aleatórios explícito.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  std::vector<std::pair<K, V>> sample(std::size_t k, URBG& gen) const;
+
  private:
-  BST<Pair> data;  ///< A Árvore Binária que armazena os pares chave-valor.
+  /**
+   * @brief Constrói um mapa a partir de uma árvore já pronta.
+   */
+  explicit Map(AVL<Pair>&& tree) : data(std::move(tree)) {}
+
+  /**
+   * @brief Seleciona os `k` pares que vêm primeiro segundo `before` (veja
+   * `AVL::select_k`).
+   *
+   * @param before Função `bool(const Pair&, const Pair&)` que diz se o
+   * primeiro par vem antes do segundo no resultado.
+   */
+  template <class Before>
+  std::vector<std::pair<K, V>> select_k(std::size_t k, Before before) const;
+
+  /**
+   * @brief Converte os pares internos para `std::pair`.
+   */
+  static std::vector<std::pair<K, V>> to_pairs(const std::vector<Pair>& pairs);
+
+  AVL<Pair> data;  ///< A Árvore AVL que armazena os pares chave-valor.
 };
 
+/**
+ * @brief Conjunto de alterações pendentes sobre um `Map`, aplicadas de forma
+ * atômica.
+ *
+ * Leituras pela transação enxergam as alterações pendentes. O mapa original
+ * não é modificado até `commit`, que aplica todas as escritas e remoções em
+ * uma única passada de divisão e junção da árvore: ou todas são aplicadas ou,
+ * se `commit` lançar uma exceção, nenhuma. Desfazer custa apenas descartar o
+ * buffer, proporcional às chaves tocadas, e não ao tamanho do mapa.
+ *
+ * O mapa não deve ser alterado diretamente enquanto a transação estiver
+ * ativa.
+ */
+template <class K, class V>
+class Map<K, V>::Transaction {
+ public:
+  Transaction(const Transaction&) = delete;
+  Transaction& operator=(const Transaction&) = delete;
+
+  /**
+   * @brief Acessa o valor pendente de uma chave.
+   *
+   * Na primeira vez que a chave é tocada, o valor atual do mapa é copiado
+   * para o buffer (ou o valor padrão de `V`, se a chave não existir ou tiver
+   * sido removida na transação).
+   *
+   * @param key A chave para buscar ou inserir.
+   * @return Referência ao valor pendente.
+   */
+  V& operator[](const K& key);
+
+  /**
+   * @brief Marca uma chave para remoção.
+   *
+   * @param key A chave a remover.
+   * @return `true` se a chave existia (considerando as alterações
+   * pendentes), `false` caso contrário.
+   */
+  bool remove(const K& key);
+
+  /**
+   * @brief Aplica todas as alterações pendentes ao mapa e esvazia o buffer.
+   *
+   * Se lançar uma exceção, o mapa permanece inalterado e as alterações
+   * continuam pendentes.
+   */
+  void commit();
+
+  /**
+   * @brief Descarta todas as alterações pendentes.
+   */
+  void rollback();
+
+ private:
+  friend class Map;
+
+  /**
+   * @brief Alteração pendente de uma chave: um valor a escrever ou, se
+   * vazio, uma remoção.
+   */
+  struct Entry {
+    K key;                   ///< A chave alterada.
+    std::optional<V> value;  ///< Novo valor, ou vazio para remoção.
+
+    explicit Entry(const K& k) : key(k), value() {}
+
+    bool operator<(const Entry& other) const { return key < other.key; }
+  };
+
+  explicit Transaction(Map& m) : map(m) {}
+
+  Map& map;           ///< O mapa alterado pela transação.
+  AVL<Entry> staged;  ///< Alterações pendentes, ordenadas por chave.
+};
+
+template <class K, class V>
+V& Map<K, V>::Transaction::operator[](const K& key) {
+  Entry probe(key);
+  auto* node = staged.find_node(probe);
+  if (node == nullptr) {
+    const auto* current = map.data.find_node(lookup(key));
+    if (current != nullptr) probe.value = current->data.value;
+    staged.insert(probe);
+    node = staged.find_node(probe);
+  }
+  if (!node->data.value) node->data.value.emplace();
+  return *node->data.value;
+}
+
+template <class K, class V>
+bool Map<K, V>::Transaction::remove(const K& key) {
+  Entry probe(key);
+  auto* node = staged.find_node(probe);
+  if (node != nullptr) {
+    bool existed = node->data.value.has_value();
+    node->data.value.reset();
+    return existed;
+  }
+  if (map.data.find_node(lookup(key)) == nullptr) return false;
+  staged.insert(probe);
+  return true;
+}
+
+template <class K, class V>
+void Map<K, V>::Transaction::commit() {
+  std::vector<Pair> writes;
+  std::vector<Pair> removes;
+  for (const Entry& entry : staged.lazy_in_order()) {
+    // Escritas em chaves existentes substituem o nó antigo
+    removes.emplace_back(entry.key);
+    if (entry.value) writes.emplace_back(entry.key, *entry.value);
+  }
+  map.data.apply_batch(writes, removes);
+  rollback();
+}
+
+template <class K, class V>
+void Map<K, V>::Transaction::rollback() {
+  staged = AVL<Entry>();
+}
+
 template <class K, class V>
 Map<K, V>::Map() {}
 
 template <class K, class V>
 V& Map<K, V>::operator[](const K& key) {
-  Pair search_pair(key);
-  auto* node = data.find_node(search_pair);
-
+  // Procura só pela chave; o Pair (e o V padrão) é montado apenas quando a
+  // chave não existe
+  auto* node = data.find_node(lookup(key));
   if (node == nullptr) {
-    // Chave não encontrada, insere um novo par com valor padrão
-    data.insert(search_pair);
-    // Encontra o nó recém-inserido para retornar a referência ao valor
-    node = data.find_node(search_pair);
+    node = data.insert_or_find(Pair(key)).first;
   }
+  return node->data.value;
+}
 
+template <class K, class V>
+template <HeterogeneousKey<K> Q>
+  requires std::constructible_from<K, const Q&>
+V& Map<K, V>::operator[](const Q& key) {
+  auto* node = data.find_node(lookup(key));
+  if (node == nullptr) {
+    node = data.insert_or_find(Pair(K(key))).first;
+  }
   return node->data.value;
 }
 
 template <class K, class V>
 const V& Map<K, V>::operator[](const K& key) const {
-  Pair search_pair(key);
-  const auto* node = data.find_node(search_pair);
+  // Busca pela chave diretamente, sem montar um Pair (e um V) temporário
+  const auto* node = data.find_node(lookup(key));
 
   if (node == nullptr) {
     // Chave não encontrada na versão const, lança exceção
@@ -122,8 +578,216 @@ const V& Map<K, V>::operator[](const K& key) const {
   return node->data.value;
 }
 
+template <class K, class V>
+template <HeterogeneousKey<K> Q>
+const V& Map<K, V>::operator[](const Q& key) const {
+  const auto* node = data.find_node(lookup(key));
+  if (node == nullptr) {
+    throw std::out_of_range("Key not found in map");
+  }
+  return node->data.value;
+}
+
 template <class K, class V>
 bool Map<K, V>::remove(const K& key) {
-  Pair search_pair(key);
-  return data.remove(search_pair);
-}
\ No newline at end of file
+  return data.remove(lookup(key));
+}
+
+template <class K, class V>
+template <HeterogeneousKey<K> Q>
+bool Map<K, V>::remove(const Q& key) {
+  return data.remove(lookup(key));
+}
+
+template <class K, class V>
+bool Map<K, V>::remove_lazy(const K& key) {
+  return data.remove_lazy(lookup(key));
+}
+
+template <class K, class V>
+void Map<K, V>::purge() {
+  data.purge();
+}
+
+template <class K, class V>
+std::size_t Map<K, V>::size() const {
+  return data.size();
+}
+
+template <class K, class V>
+void Map<K, V>::parallel_in_order(std::span<std::pair<K, V>> out) const {
+  data.parallel_in_order(out, [](const Pair& pair) {
+    return std::pair<const K&, const V&>(pair.key, pair.value);
+  });
+}
+
+template <class K, class V>
+template <class Visitor>
+void Map<K, V>::parallel_for_each(Visitor visit) const {
+  data.parallel_for_each(
+      [&](const Pair& pair) { visit(pair.key, pair.value); });
+}
+
+template <class K, class V>
+template <class R, class Mapper, class Reducer>
+R Map<K, V>::parallel_reduce(R identity, Mapper mapper,
+                             Reducer reducer) const {
+  return data.parallel_reduce(
+      std::move(identity),
+      [&](const Pair& pair) { return mapper(pair.key, pair.value); }, reducer);
+}
+
+template <class K, class V>
+template <class Predicate>
+Map<K, V> Map<K, V>::filter(Predicate pred) const {
+  return Map(
+      data.filter([&](const Pair& pair) { return pred(pair.key, pair.value); }));
+}
+
+template <class K, class V>
+template <class Range>
+std::size_t Map<K, V>::insert_batch(const Range& entries) {
+  std::vector<Pair> pairs;
+  for (const auto& [key, value] : entries) {
+    pairs.emplace_back(key, value);
+  }
+  return data.insert_batch(pairs);
+}
+
+template <class K, class V>
+template <class Range>
+std::size_t Map<K, V>::remove_batch(const Range& keys) {
+  std::vector<Pair> pairs;
+  for (const auto& key : keys) {
+    pairs.emplace_back(key);
+  }
+  return data.remove_batch(pairs);
+}
+
+template <class K, class V>
+typename Map<K, V>::Transaction Map<K, V>::transaction() {
+  return Transaction(*this);
+}
+
+template <class K, class V>
+template <class Combine>
+bool Map<K, V>::upsert(const K& key, const V& value, Combine combine) {
+  auto [node, inserted] = data.insert_or_find(Pair(key, value));
+  if (!inserted) {
+    node->data.value = combine(node->data.value, value);
+  }
+  return inserted;
+}
+
+template <class K, class V>
+template <class Range, class Combine>
+std::size_t Map<K, V>::upsert_batch(const Range& entries, Combine combine) {
+  std::vector<Pair> pairs;
+  for (const auto& [key, value] : entries) {
+    pairs.emplace_back(key, value);
+  }
+  std::stable_sort(pairs.begin(), pairs.end());
+
+  // Combina as repetições do lote, preservando a ordem de chegada
+  std::vector<Pair> folded;
+  for (Pair& pair : pairs) {
+    if (!folded.empty() && !(folded.back() < pair)) {
+      folded.back().value = combine(folded.back().value, pair.value);
+    } else {
+      folded.push_back(std::move(pair));
+    }
+  }
+
+  return data.insert_batch(folded, [&](Pair& existing, const Pair& incoming) {
+    existing.value = combine(existing.value, incoming.value);
+  });
+}
+
+template <class K, class V>
+template <class Combine>
+std::size_t Map<K, V>::merge_from(const Map& other, Combine combine) {
+  std::vector<Pair> pairs;
+  pairs.reserve(other.size());
+  for (const Pair& pair : other.data.lazy_in_order()) {
+    pairs.push_back(pair);
+  }
+  return data.insert_batch(pairs, [&](Pair& existing, const Pair& incoming) {
+    existing.value = combine(existing.value, incoming.value);
+  });
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::top_k(std::size_t k) const {
+  return to_pairs(data.top_k(k));
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::bottom_k(std::size_t k) const {
+  return to_pairs(data.bottom_k(k));
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::top_k_by_value(std::size_t k) const {
+  return select_k(k, [](const Pair& a, const Pair& b) {
+    if (b.value < a.value) return true;
+    if (a.value < b.value) return false;
+    return a.key < b.key;
+  });
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::bottom_k_by_value(
+    std::size_t k) const {
+  return select_k(k, [](const Pair& a, const Pair& b) {
+    if (a.value < b.value) return true;
+    if (b.value < a.value) return false;
+    return a.key < b.key;
+  });
+}
+
+template <class K, class V>
+template <class Before>
+std::vector<std::pair<K, V>> Map<K, V>::select_k(std::size_t k,
+                                                 Before before) const {
+  std::vector<std::pair<K, V>> result;
+  for (const Pair* pair : data.select_k(k, before)) {
+    result.emplace_back(pair->key, pair->value);
+  }
+  return result;
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::to_pairs(
+    const std::vector<Pair>& pairs) {
+  std::vector<std::pair<K, V>> result;
+  result.reserve(pairs.size());
+  for (const Pair& pair : pairs) {
+    result.emplace_back(pair.key, pair.value);
+  }
+  return result;
+}
+
+template <class K, class V>
+std::pair<K, V> Map<K, V>::sample() const {
+  Pair pair = data.sample();
+  return {pair.key, pair.value};
+}
+
+template <class K, class V>
+std::vector<std::pair<K, V>> Map<K, V>::sample(std::size_t k) const {
+  return to_pairs(data.sample(k));
+}
+
+template <class K, class V>
+template <std::uniform_random_bit_generator URBG>
+std::pair<K, V> Map<K, V>::sample(URBG& gen) const {
+  Pair pair = data.sample(gen);
+  return {pair.key, pair.value};
+}
+
+template <class K, class V>
+template <std::uniform_random_bit_generator URBG>
+std::vector<std::pair<K, V>> Map<K, V>::sample(std::size_t k,
+                                               URBG& gen) const {
+  return to_pairs(data.sample(k, gen));
+}
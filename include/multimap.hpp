@@ -0,0 +1,171 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "avl.hpp"
+#include "small_vector.hpp"
+
+/**
+ * @brief Mapa associativo ordenado que admite várias entradas por chave.
+ *
+ * Cada chave distinta ocupa um único nó da árvore AVL, que guarda os valores
+ * associados em um `SmallVector` contíguo. Chaves com poucos valores não
+ * fazem nenhuma alocação além do nó, e a memória é proporcional ao número
+ * de chaves distintas mais o número de valores.
+ *
+ * @tparam K Tipo da chave. Deve suportar o operador '<'.
+ * @tparam V Tipo dos valores.
+ * @tparam N Quantidade de valores por chave armazenados dentro do nó.
+ */
+template <class K, class V, std::size_t N = 2>
+class MultiMap {
+ private:
+  /**
+   * @brief Chave e lista dos seus valores, na ordem de inserção.
+   */
+  struct Bucket {
+    K key;                     ///< A chave.
+    SmallVector<V, N> values;  ///< Valores associados (nunca vazio na árvore).
+
+    explicit Bucket(const K& k) : key(k), values() {}
+
+    bool operator<(const Bucket& other) const { return key < other.key; }
+
+    /**
+     * @brief Comparações com a chave avulsa, usadas nas buscas para não
+     * construir um Bucket.
+     */
+    template <class Q>
+      requires(!std::same_as<Q, Bucket> && LessComparableWith<Q, K>)
+    friend bool operator<(const Bucket& bucket, const Q& key) {
+      return bucket.key < key;
+    }
+
+    template <class Q>
+      requires(!std::same_as<Q, Bucket> && LessComparableWith<Q, K>)
+    friend bool operator<(const Q& key, const Bucket& bucket) {
+      return key < bucket.key;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um multimapa vazio.
+   */
+  MultiMap();
+
+  /**
+   * @brief Associa mais um valor à chave, em uma única descida.
+   *
+   * @param key A chave.
+   * @param value O valor, adicionado após os já existentes.
+   */
+  void insert(const K& key, const V& value);
+
+  /**
+   * @brief Retorna os valores associados à chave, na ordem de inserção.
+   *
+   * A visão é válida até a próxima alteração do multimapa.
+   *
+   * @param key A chave.
+   * @return Visão contígua dos valores, vazia se a chave não existir.
+   */
+  std::span<const V> find(const K& key) const;
+
+  /**
+   * @brief Retorna a quantidade de valores associados à chave.
+   */
+  std::size_t count(const K& key) const;
+
+  /**
+   * @brief Remove a chave e todos os seus valores.
+   *
+   * @param key A chave.
+   * @return Quantidade de valores removidos.
+   */
+  std::size_t remove(const K& key);
+
+  /**
+   * @brief Remove a primeira ocorrência de `value` associada à chave.
+   *
+   * Se era o último valor da chave, a chave também é removida. `V` deve
+   * suportar o operador '=='.
+   *
+   * @param key A chave.
+   * @param value O valor a remover.
+   * @return `true` se o valor foi encontrado e removido.
+   */
+  bool remove(const K& key, const V& value);
+
+  /**
+   * @brief Retorna o total de valores, somando todas as chaves.
+   */
+  std::size_t size() const { return total; }
+
+  /**
+   * @brief Retorna a quantidade de chaves distintas.
+   */
+  std::size_t distinct() const { return data.size(); }
+
+ private:
+  AVL<Bucket> data;       ///< Um nó por chave distinta.
+  std::size_t total = 0;  ///< Total de valores.
+};
+
+template <class K, class V, std::size_t N>
+MultiMap<K, V, N>::MultiMap() {}
+
+template <class K, class V, std::size_t N>
+void MultiMap<K, V, N>::insert(const K& key, const V& value) {
+  auto* node = data.find_node(key);
+  if (node == nullptr) {
+    node = data.insert_or_find(Bucket(key)).first;
+  }
+  try {
+    node->data.values.push_back(value);
+  } catch (...) {
+    // Não deixa uma chave sem valores na árvore
+    if (node->data.values.empty()) data.remove(key);
+    throw;
+  }
+  ++total;
+}
+
+template <class K, class V, std::size_t N>
+std::span<const V> MultiMap<K, V, N>::find(const K& key) const {
+  const auto* node = data.find_node(key);
+  if (node == nullptr) return {};
+  return {node->data.values.data(), node->data.values.size()};
+}
+
+template <class K, class V, std::size_t N>
+std::size_t MultiMap<K, V, N>::count(const K& key) const {
+  return find(key).size();
+}
+
+template <class K, class V, std::size_t N>
+std::size_t MultiMap<K, V, N>::remove(const K& key) {
+  const auto* node = data.find_node(key);
+  if (node == nullptr) return 0;
+  std::size_t removed = node->data.values.size();
+  data.remove(key);
+  total -= removed;
+  return removed;
+}
+
+template <class K, class V, std::size_t N>
+bool MultiMap<K, V, N>::remove(const K& key, const V& value) {
+  auto* node = data.find_node(key);
+  if (node == nullptr) return false;
+  auto& values = node->data.values;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (values[i] == value) {
+      values.erase(i);
+      if (values.empty()) data.remove(key);
+      --total;
+      return true;
+    }
+  }
+  return false;
+}
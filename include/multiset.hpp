@@ -0,0 +1,164 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+#include "avl.hpp"
+
+/**
+ * @brief Multiconjunto ordenado (conjunto que admite repetições).
+ *
+ * Armazena um único nó por valor distinto, acompanhado da quantidade de
+ * cópias. A memória é proporcional ao número de valores distintos, e não ao
+ * total de cópias, o que favorece dados com muitas repetições.
+ *
+ * @tparam T Tipo dos elementos. Deve suportar o operador '<'.
+ */
+template <class T>
+class MultiSet {
+ private:
+  /**
+   * @brief Valor distinto e sua quantidade de cópias.
+   */
+  struct Bucket {
+    T value;            ///< O valor.
+    std::size_t count;  ///< Quantidade de cópias (sempre positiva na árvore).
+
+    explicit Bucket(const T& v, std::size_t c = 0) : value(v), count(c) {}
+
+    bool operator<(const Bucket& other) const { return value < other.value; }
+
+    /**
+     * @brief Comparações com o valor avulso, usadas nas buscas para não
+     * construir um Bucket.
+     */
+    template <class Q>
+      requires(!std::same_as<Q, Bucket> && LessComparableWith<Q, T>)
+    friend bool operator<(const Bucket& bucket, const Q& value) {
+      return bucket.value < value;
+    }
+
+    template <class Q>
+      requires(!std::same_as<Q, Bucket> && LessComparableWith<Q, T>)
+    friend bool operator<(const Q& value, const Bucket& bucket) {
+      return value < bucket.value;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um multiconjunto vazio.
+   */
+  MultiSet();
+
+  /**
+   * @brief Insere `copies` cópias de `value`, em uma única descida.
+   *
+   * @param value O valor.
+   * @param copies Quantidade de cópias a inserir.
+   * @return A nova quantidade de cópias de `value`.
+   */
+  std::size_t insert(const T& value, std::size_t copies = 1);
+
+  /**
+   * @brief Remove uma cópia de `value`.
+   *
+   * @param value O valor.
+   * @return `true` se havia alguma cópia.
+   */
+  bool remove(const T& value);
+
+  /**
+   * @brief Remove todas as cópias de `value`.
+   *
+   * @param value O valor.
+   * @return Quantidade de cópias removidas.
+   */
+  std::size_t remove_all(const T& value);
+
+  /**
+   * @brief Retorna a quantidade de cópias de `value`.
+   */
+  std::size_t count(const T& value) const;
+
+  /**
+   * @brief Verifica se há ao menos uma cópia de `value`.
+   */
+  bool contain(const T& value) const;
+
+  /**
+   * @brief Retorna o total de elementos, contando as repetições.
+   */
+  std::size_t size() const { return total; }
+
+  /**
+   * @brief Retorna a quantidade de valores distintos.
+   */
+  std::size_t distinct() const { return data.size(); }
+
+  /**
+   * @brief Retorna os elementos em ordem crescente, com as repetições.
+   */
+  std::vector<T> in_order() const;
+
+ private:
+  AVL<Bucket> data;       ///< Um nó por valor distinto.
+  std::size_t total = 0;  ///< Total de cópias.
+};
+
+template <class T>
+MultiSet<T>::MultiSet() {}
+
+template <class T>
+std::size_t MultiSet<T>::insert(const T& value, std::size_t copies) {
+  if (copies == 0) return count(value);
+  auto* node = data.find_node(value);
+  if (node == nullptr) {
+    node = data.insert_or_find(Bucket(value)).first;
+  }
+  node->data.count += copies;
+  total += copies;
+  return node->data.count;
+}
+
+template <class T>
+bool MultiSet<T>::remove(const T& value) {
+  auto* node = data.find_node(value);
+  if (node == nullptr) return false;
+  if (--node->data.count == 0) {
+    data.remove(value);
+  }
+  --total;
+  return true;
+}
+
+template <class T>
+std::size_t MultiSet<T>::remove_all(const T& value) {
+  auto* node = data.find_node(value);
+  if (node == nullptr) return 0;
+  std::size_t removed = node->data.count;
+  data.remove(value);
+  total -= removed;
+  return removed;
+}
+
+template <class T>
+std::size_t MultiSet<T>::count(const T& value) const {
+  const auto* node = data.find_node(value);
+  return node ? node->data.count : 0;
+}
+
+template <class T>
+bool MultiSet<T>::contain(const T& value) const {
+  return data.contain(value);
+}
+
+template <class T>
+std::vector<T> MultiSet<T>::in_order() const {
+  std::vector<T> result;
+  result.reserve(total);
+  for (const Bucket& bucket : data.lazy_in_order()) {
+    result.insert(result.end(), bucket.count, bucket.value);
+  }
+  return result;
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include "avl.hpp"
+
+/**
+ * @brief Multiconjunto ordenado com consultas de quantis em O(log n).
+ *
+ * Mantém os valores em uma Árvore AVL com tamanho de subárvore, de modo que
+ * inserir, remover e consultar qualquer quantil (mediana, p99, ...) custam
+ * O(log n), sem reordenar os dados. Valores repetidos são permitidos: cada
+ * cópia ocupa um nó, desempatado por um número de sequência.
+ *
+ * Útil para medianas e percentis em janelas deslizantes: a cada passo,
+ * insere-se o valor novo e remove-se o que saiu da janela.
+ *
+ * @tparam T Tipo dos valores. Deve suportar o operador '<'.
+ */
+template <class T>
+class QuantileSet {
+ private:
+  /**
+   * @brief Cópia de um valor, distinguida das demais pela sequência.
+   */
+  struct Entry {
+    T value;          ///< O valor armazenado.
+    std::size_t seq;  ///< Ordem de inserção, para desempatar repetidos.
+
+    Entry(const T& v, std::size_t s) : value(v), seq(s) {}
+
+    bool operator<(const Entry& other) const {
+      if (value < other.value) return true;
+      if (other.value < value) return false;
+      return seq < other.seq;
+    }
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria um multiconjunto vazio.
+   */
+  QuantileSet();
+
+  /**
+   * @brief Insere uma cópia de `value`, mesmo que ele já exista.
+   *
+   * @param value Valor a inserir.
+   */
+  void insert(const T& value);
+
+  /**
+   * @brief Remove uma cópia de `value`.
+   *
+   * @param value Valor a remover.
+   * @return `true` se havia alguma cópia de `value`.
+   */
+  bool remove(const T& value);
+
+  /**
+   * @brief Retorna a quantidade de valores, contando as repetições.
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Retorna quantas cópias de `value` existem, em O(log n).
+   */
+  std::size_t count(const T& value) const;
+
+  /**
+   * @brief Retorna quantos valores são estritamente menores que `value`.
+   */
+  std::size_t rank(const T& value) const;
+
+  /**
+   * @brief Retorna o quantil `q` (quantil inferior).
+   *
+   * É o valor de posição `floor(q * (size() - 1))` na ordem crescente, ou
+   * seja, `quantile(0)` é o mínimo, `quantile(1)` é o máximo e
+   * `quantile(0.5)` é a mediana inferior.
+   *
+   * @param q Fração entre 0 e 1.
+   * @return O valor do quantil.
+   * @throw std::out_of_range se o multiconjunto estiver vazio ou se `q`
+   * estiver fora de [0, 1].
+   */
+  const T& quantile(double q) const;
+
+  /**
+   * @brief Retorna a mediana inferior, equivalente a `quantile(0.5)`.
+   */
+  const T& median() const { return quantile(0.5); }
+
+ private:
+  AVL<Entry> data;           ///< Cópias dos valores, em ordem crescente.
+  std::size_t next_seq = 1;  ///< Próximo número de sequência.
+};
+
+template <class T>
+QuantileSet<T>::QuantileSet() {}
+
+template <class T>
+void QuantileSet<T>::insert(const T& value) {
+  data.insert(Entry(value, next_seq++));
+}
+
+template <class T>
+bool QuantileSet<T>::remove(const T& value) {
+  // A sequência 0 nunca é usada: (value, 0) vem antes de todas as cópias
+  std::size_t first = data.rank(Entry(value, 0));
+  if (first == data.size()) return false;
+  const Entry& entry = data.select(first);
+  if (value < entry.value) return false;
+  return data.remove(Entry(entry));
+}
+
+template <class T>
+std::size_t QuantileSet<T>::size() const {
+  return data.size();
+}
+
+template <class T>
+std::size_t QuantileSet<T>::count(const T& value) const {
+  // (value, máximo) vem depois de todas as cópias de `value`
+  std::size_t after = data.rank(Entry(value, static_cast<std::size_t>(-1)));
+  return after - rank(value);
+}
+
+template <class T>
+std::size_t QuantileSet<T>::rank(const T& value) const {
+  return data.rank(Entry(value, 0));
+}
+
+template <class T>
+const T& QuantileSet<T>::quantile(double q) const {
+  if (data.size() == 0) {
+    throw std::out_of_range("Quantile of an empty set");
+  }
+  if (!(q >= 0.0 && q <= 1.0)) {
+    throw std::out_of_range("Quantile fraction must be in [0, 1]");
+  }
+  auto position = static_cast<std::size_t>(
+      std::floor(q * static_cast<double>(data.size() - 1)));
+  return data.select(position).value;
+}
@@ -0,0 +1,318 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Escalonador de tarefas com roubo de trabalho (work stealing).
+ *
+ * Mantém um conjunto fixo de threads trabalhadoras, cada uma com sua própria
+ * fila dupla de tarefas. Uma thread que bifurca trabalho (`fork_join`) empilha
+ * uma das metades no fim da sua fila e executa a outra imediatamente; threads
+ * ociosas roubam tarefas do início das filas das demais. Assim, as tarefas
+ * grandes (mais próximas da raiz da recursão) são as roubadas primeiro.
+ *
+ * Enquanto espera uma tarefa roubada terminar, a thread continua executando
+ * outras tarefas em vez de bloquear, de forma que recursões aninhadas de
+ * `fork_join` não esgotam as threads. Threads externas (que não pertencem ao
+ * escalonador) também podem chamar `fork_join`: suas tarefas vão para uma
+ * fila compartilhada.
+ *
+ * Todas as operações paralelas dos containers usam a instância global
+ * (`Scheduler::global()`), cujo número de trabalhadores pode ser configurado
+ * com `Scheduler::set_global_workers`.
+ */
+class Scheduler {
+ public:
+  /**
+   * @brief Cria o escalonador e inicia as threads trabalhadoras.
+   *
+   * @param workers Quantidade de threads trabalhadoras. Com 0, `fork_join`
+   * executa as duas metades sequencialmente na thread que o chamou.
+   */
+  explicit Scheduler(unsigned workers = default_workers());
+
+  /**
+   * @brief Encerra e aguarda as threads trabalhadoras.
+   *
+   * Não deve ser chamado enquanto houver um `fork_join` em andamento.
+   */
+  ~Scheduler();
+
+  Scheduler(const Scheduler&) = delete;
+  Scheduler& operator=(const Scheduler&) = delete;
+
+  /**
+   * @brief Retorna a quantidade de threads trabalhadoras.
+   */
+  unsigned workers() const { return static_cast<unsigned>(threads.size()); }
+
+  /**
+   * @brief Executa `left` e `right`, possivelmente em paralelo, e retorna
+   * quando ambas terminarem.
+   *
+   * `left` fica disponível para ser roubada por outra thread enquanto `right`
+   * executa na thread atual. Se ninguém a roubar, também é executada pela
+   * thread atual. Se alguma das funções lançar uma exceção, ela é propagada
+   * depois que as duas terminarem (a de `right` tem prioridade).
+   *
+   * @param left Função sem argumentos a ser executada.
+   * @param right Função sem argumentos a ser executada.
+   */
+  template <class Left, class Right>
+  void fork_join(const Left& left, const Right& right);
+
+  /**
+   * @brief Número padrão de trabalhadores: um a menos que o número de
+   * núcleos, já que a thread que chama `fork_join` também trabalha.
+   */
+  static unsigned default_workers() {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+  }
+
+  /**
+   * @brief Retorna o escalonador global, criando-o no primeiro uso com
+   * `default_workers()` trabalhadores.
+   */
+  static Scheduler& global() { return *global_instance(); }
+
+  /**
+   * @brief Recria o escalonador global com outro número de trabalhadores.
+   *
+   * Deve ser chamado quando nenhuma operação paralela estiver em andamento
+   * (tipicamente na inicialização da aplicação ou de um teste).
+   *
+   * @param workers Nova quantidade de threads trabalhadoras.
+   */
+  static void set_global_workers(unsigned workers) {
+    global_instance().reset();
+    global_instance() = std::make_unique<Scheduler>(workers);
+  }
+
+ private:
+  /**
+   * @brief Tarefa bifurcada. Vive na pilha da thread que chamou `fork_join`,
+   * que só retorna depois de `done` ser verdadeiro.
+   */
+  struct Task {
+    void (*function)(const void*);  ///< Executa a função apontada.
+    const void* context;            ///< Ponteiro para a função do usuário.
+    std::exception_ptr error;       ///< Exceção lançada pela tarefa.
+    std::atomic<bool> done{false};  ///< Indica que a tarefa terminou.
+  };
+
+  /**
+   * @brief Fila dupla de tarefas de uma thread, protegida por mutex.
+   */
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task*> tasks;
+  };
+
+  /**
+   * @brief Laço principal de uma thread trabalhadora.
+   *
+   * @param index Índice da fila própria da thread.
+   */
+  void work(unsigned index);
+
+  /**
+   * @brief Índice da fila usada pela thread atual: a própria fila para
+   * trabalhadores deste escalonador ou a fila compartilhada para as demais.
+   */
+  unsigned queue_index() const;
+
+  /**
+   * @brief Empilha uma tarefa no fim da fila `index` e acorda um trabalhador.
+   */
+  void push(unsigned index, Task* task);
+
+  /**
+   * @brief Retira `task` da fila `index` se ela ainda não foi roubada.
+   *
+   * @return `true` se a tarefa foi retirada e deve ser executada pela thread
+   * atual.
+   */
+  bool take_back(unsigned index, Task* task);
+
+  /**
+   * @brief Executa uma tarefa pendente: primeiro do fim da própria fila e,
+   * se ela estiver vazia, do início das filas das outras threads.
+   *
+   * @param index Índice da fila da thread atual.
+   * @return `true` se alguma tarefa foi executada.
+   */
+  bool run_one(unsigned index);
+
+  /**
+   * @brief Executa a tarefa, guardando uma eventual exceção, e a marca como
+   * concluída.
+   */
+  static void execute(Task* task);
+
+  static std::unique_ptr<Scheduler>& global_instance() {
+    static std::unique_ptr<Scheduler> instance =
+        std::make_unique<Scheduler>();
+    return instance;
+  }
+
+  /// Escalonador ao qual a thread atual pertence, se for trabalhadora.
+  static inline thread_local const Scheduler* current = nullptr;
+  /// Índice da fila da thread atual em `current`.
+  static inline thread_local unsigned current_index = 0;
+
+  std::vector<std::unique_ptr<Queue>> queues;  ///< Uma por trabalhador, mais
+                                               ///< a compartilhada (última).
+  std::vector<std::thread> threads;            ///< Threads trabalhadoras.
+  std::atomic<std::size_t> pending{0};  ///< Tarefas aguardando nas filas.
+  std::atomic<bool> stopping{false};    ///< Sinaliza o encerramento.
+  std::mutex sleep_mutex;               ///< Protege a espera dos ociosos.
+  std::condition_variable wake;         ///< Acorda trabalhadores ociosos.
+};
+
+inline Scheduler::Scheduler(unsigned workers) {
+  for (unsigned i = 0; i <= workers; ++i) {
+    queues.push_back(std::make_unique<Queue>());
+  }
+  threads.reserve(workers);
+  for (unsigned i = 0; i < workers; ++i) {
+    threads.emplace_back([this, i] { work(i); });
+  }
+}
+
+inline Scheduler::~Scheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+template <class Left, class Right>
+void Scheduler::fork_join(const Left& left, const Right& right) {
+  if (threads.empty()) {
+    left();
+    right();
+    return;
+  }
+
+  Task task;
+  task.function = [](const void* context) {
+    (*static_cast<const Left*>(context))();
+  };
+  task.context = &left;
+
+  unsigned index = queue_index();
+  push(index, &task);
+
+  std::exception_ptr right_error;
+  try {
+    right();
+  } catch (...) {
+    right_error = std::current_exception();
+  }
+
+  if (take_back(index, &task)) {
+    execute(&task);
+  } else {
+    // A tarefa foi roubada: ajuda com outras tarefas enquanto espera
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (!run_one(index)) std::this_thread::yield();
+    }
+  }
+
+  if (right_error) std::rethrow_exception(right_error);
+  if (task.error) std::rethrow_exception(task.error);
+}
+
+inline void Scheduler::work(unsigned index) {
+  current = this;
+  current_index = index;
+  while (true) {
+    if (run_one(index)) continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    wake.wait(lock, [this] { return stopping || pending > 0; });
+    if (stopping) return;
+  }
+}
+
+inline unsigned Scheduler::queue_index() const {
+  if (current == this) return current_index;
+  return static_cast<unsigned>(queues.size() - 1);
+}
+
+inline void Scheduler::push(unsigned index, Task* task) {
+  // Conta antes de publicar, para que quem retirar a tarefa nunca veja o
+  // contador abaixo de zero
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    ++pending;
+  }
+  try {
+    std::lock_guard<std::mutex> lock(queues[index]->mutex);
+    queues[index]->tasks.push_back(task);
+  } catch (...) {
+    // A tarefa não foi publicada: sem desfazer a contagem, as threads
+    // acordariam para sempre atrás de uma tarefa que não existe
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    --pending;
+    throw;
+  }
+  wake.notify_one();
+}
+
+inline bool Scheduler::take_back(unsigned index, Task* task) {
+  Queue& queue = *queues[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  // Na fila própria a tarefa, se presente, é a última; na compartilhada
+  // outras threads externas podem ter empilhado depois dela.
+  auto it = std::find(queue.tasks.rbegin(), queue.tasks.rend(), task);
+  if (it == queue.tasks.rend()) return false;
+  queue.tasks.erase(std::next(it).base());
+  --pending;
+  return true;
+}
+
+inline bool Scheduler::run_one(unsigned index) {
+  Task* task = nullptr;
+  {
+    Queue& own = *queues[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = own.tasks.back();
+      own.tasks.pop_back();
+    }
+  }
+  for (std::size_t i = 1; task == nullptr && i < queues.size(); ++i) {
+    Queue& victim = *queues[(index + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+    }
+  }
+  if (task == nullptr) return false;
+  --pending;
+  execute(task);
+  return true;
+}
+
+inline void Scheduler::execute(Task* task) {
+  try {
+    task->function(task->context);
+  } catch (...) {
+    task->error = std::current_exception();
+  }
+  task->done.store(true, std::memory_order_release);
+}
@@ -1,4 +1,10 @@
 #pragma once
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
 #include "avl.hpp"
 
 /**
@@ -44,6 +50,33 @@ class Set {
    */
   bool remove(const T& value);
 
+  /**
+   * @brief Remove o elemento equivalente a uma chave de outro tipo (por
+   * exemplo, `std::string_view` em um `Set<std::string>`), sem construir um
+   * `T`.
+   *
+   * @param key Chave comparável com `T` pelo operador '<'.
+   * @return `true` se o elemento foi removido.
+   */
+  template <HeterogeneousKey<T> Q>
+  bool remove(const Q& key);
+
+  /**
+   * @brief Remove um elemento apenas marcando-o, sem rotações.
+   *
+   * Indicado para rajadas de remoções: as marcas são descartadas em lote
+   * quando superam os elementos presentes, ou por `purge`.
+   *
+   * @param value O valor a ser removido.
+   * @return `true` se o elemento foi removido.
+   */
+  bool remove_lazy(const T& value);
+
+  /**
+   * @brief Descarta as marcas deixadas por `remove_lazy`, em O(n).
+   */
+  void purge();
+
   /**
    * @brief Verifica se um elemento está contido no conjunto.
    *
@@ -53,7 +86,135 @@ class Set {
    */
   bool search(const T& value) const;
 
+  /**
+   * @brief Verifica se há um elemento equivalente a uma chave de outro tipo,
+   * sem construir um `T`.
+   *
+   * @param key Chave comparável com `T` pelo operador '<'.
+   */
+  template <HeterogeneousKey<T> Q>
+  bool search(const Q& key) const;
+
+  /**
+   * @brief Retorna a quantidade de elementos do conjunto.
+   *
+   * @return Número de elementos armazenados.
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Exporta os elementos em ordem crescente para um vetor
+   * pré-alocado, usando várias threads.
+   *
+   * @param out Região de saída com pelo menos `size()` posições.
+   * @throw std::out_of_range se `out` for menor que o conjunto.
+   */
+  void parallel_in_order(std::span<T> out) const;
+
+  /**
+   * @brief Aplica `visit` a todos os elementos, em paralelo e em ordem não
+   * especificada.
+   *
+   * @param visit Função `void(const T&)` segura para uso concorrente.
+   */
+  template <class Visitor>
+  void parallel_for_each(Visitor visit) const;
+
+  /**
+   * @brief Reduz, em paralelo, os elementos transformados por `mapper`.
+   *
+   * @param identity Elemento neutro de `reducer`.
+   * @param mapper Função `R(const T&)`.
+   * @param reducer Função `R(R, R)` associativa.
+   * @return Resultado da redução.
+   */
+  template <class R, class Mapper, class Reducer>
+  R parallel_reduce(R identity, Mapper mapper, Reducer reducer) const;
+
+  /**
+   * @brief Retorna um novo conjunto com os elementos que satisfazem `pred`.
+   *
+   * O conjunto resultante é construído já balanceado, sem reinserções.
+   *
+   * @param pred Predicado `bool(const T&)` seguro para uso concorrente.
+   * @return Conjunto filtrado.
+   */
+  template <class Predicate>
+  Set filter(Predicate pred) const;
+
+  /**
+   * @brief Insere vários elementos de uma só vez.
+   *
+   * O lote é ordenado e unido à árvore em uma única passada, em vez de uma
+   * descida por elemento. Elementos já presentes são ignorados.
+   *
+   * @param values Intervalo de elementos a inserir.
+   * @return Quantidade de elementos efetivamente inseridos.
+   */
+  template <class Range>
+  std::size_t insert_batch(const Range& values);
+
+  /**
+   * @brief Remove vários elementos de uma só vez.
+   *
+   * @param values Intervalo de elementos a remover.
+   * @return Quantidade de elementos efetivamente removidos.
+   */
+  template <class Range>
+  std::size_t remove_batch(const Range& values);
+
+  /**
+   * @brief Retorna os `k` maiores elementos, em ordem decrescente, em
+   * O(k + log n).
+   *
+   * @param k Quantidade de elementos desejados.
+   * @return Os `min(k, size())` maiores elementos.
+   */
+  std::vector<T> top_k(std::size_t k) const;
+
+  /**
+   * @brief Retorna os `k` menores elementos, em ordem crescente, em
+   * O(k + log n).
+   *
+   * @param k Quantidade de elementos desejados.
+   * @return Os `min(k, size())` menores elementos.
+   */
+  std::vector<T> bottom_k(std::size_t k) const;
+
+  /**
+   * @brief Sorteia um elemento uniformemente, em O(log n).
+   *
+   * @return Cópia do elemento sorteado.
+   * @throw std::out_of_range se o conjunto estiver vazio.
+   */
+  T sample() const;
+
+  /**
+   * @brief Sorteia `k` elementos distintos uniformemente, em O(k log n).
+   *
+   * @param k Quantidade de elementos (limitada a `size()`).
+   * @return Os elementos sorteados, em ordem crescente.
+   */
+  std::vector<T> sample(std::size_t k) const;
+
+  /**
+   * @brief Versão de `sample()` com gerador de bits aleatórios explícito.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  T sample(URBG& gen) const;
+
+  /**
+   * @brief Versão de `sample(k)` com gerador de bits aleatórios explícito.
+   */
+  template <std::uniform_random_bit_generator URBG>
+  std::vector<T> sample(std::size_t k, URBG& gen) const;
+
  private:
+  /**
+   * @brief Constrói um conjunto a partir de uma árvore já pronta.
+   */
+  explicit Set(AVL<T>&& tree) : data(std::move(tree)) {}
+
   /**
    * @brief A Árvore AVL utilizada para armazenar os dados do conjunto.
    * * A AVL garante a ordenação e o balanceamento, resultando em operações
@@ -75,7 +236,101 @@ bool Set<T>::remove(const T& value) {
   return data.remove(value);
 }
 
+template <class T>
+template <HeterogeneousKey<T> Q>
+bool Set<T>::remove(const Q& key) {
+  return data.remove(key);
+}
+
+template <class T>
+bool Set<T>::remove_lazy(const T& value) {
+  return data.remove_lazy(value);
+}
+
+template <class T>
+void Set<T>::purge() {
+  data.purge();
+}
+
 template <class T>
 bool Set<T>::search(const T& value) const {
   return data.contain(value);
-}
\ No newline at end of file
+}
+
+template <class T>
+template <HeterogeneousKey<T> Q>
+bool Set<T>::search(const Q& key) const {
+  return data.contain(key);
+}
+
+template <class T>
+std::size_t Set<T>::size() const {
+  return data.size();
+}
+
+template <class T>
+void Set<T>::parallel_in_order(std::span<T> out) const {
+  data.parallel_in_order(out);
+}
+
+template <class T>
+template <class Visitor>
+void Set<T>::parallel_for_each(Visitor visit) const {
+  data.parallel_for_each(visit);
+}
+
+template <class T>
+template <class R, class Mapper, class Reducer>
+R Set<T>::parallel_reduce(R identity, Mapper mapper, Reducer reducer) const {
+  return data.parallel_reduce(std::move(identity), mapper, reducer);
+}
+
+template <class T>
+template <class Predicate>
+Set<T> Set<T>::filter(Predicate pred) const {
+  return Set(data.filter(pred));
+}
+
+template <class T>
+template <class Range>
+std::size_t Set<T>::insert_batch(const Range& values) {
+  return data.insert_batch(values);
+}
+
+template <class T>
+template <class Range>
+std::size_t Set<T>::remove_batch(const Range& values) {
+  return data.remove_batch(values);
+}
+
+template <class T>
+std::vector<T> Set<T>::top_k(std::size_t k) const {
+  return data.top_k(k);
+}
+
+template <class T>
+std::vector<T> Set<T>::bottom_k(std::size_t k) const {
+  return data.bottom_k(k);
+}
+
+template <class T>
+T Set<T>::sample() const {
+  return data.sample();
+}
+
+template <class T>
+std::vector<T> Set<T>::sample(std::size_t k) const {
+  return data.sample(k);
+}
+
+template <class T>
+template <std::uniform_random_bit_generator URBG>
+T Set<T>::sample(URBG& gen) const {
+  return data.sample(gen);
+}
+
+template <class T>
+template <std::uniform_random_bit_generator URBG>
+std::vector<T> Set<T>::sample(std::size_t k, URBG& gen) const {
+  return data.sample(k, gen);
+}
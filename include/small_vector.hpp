@@ -0,0 +1,241 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Vetor dinâmico com os primeiros elementos armazenados no próprio
+ * objeto.
+ *
+ * Enquanto houver no máximo `N` elementos, nenhuma alocação é feita: os
+ * elementos ficam em um buffer interno. Ao ultrapassar esse limite, os
+ * elementos passam para um buffer no heap que cresce geometricamente. Os
+ * elementos são sempre contíguos.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam N Quantidade de elementos armazenados sem alocação.
+ */
+template <class T, std::size_t N = 2>
+class SmallVector {
+  static_assert(N > 0, "SmallVector requires inline capacity");
+
+ public:
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  /**
+   * @brief Construtor padrão. Cria um vetor vazio, sem alocação.
+   */
+  SmallVector() = default;
+
+  SmallVector(const SmallVector& other);
+  SmallVector(SmallVector&& other) noexcept;
+  SmallVector& operator=(const SmallVector& other);
+  SmallVector& operator=(SmallVector&& other) noexcept;
+
+  /**
+   * @brief Destrói os elementos e libera o buffer do heap, se houver.
+   */
+  ~SmallVector();
+
+  /**
+   * @brief Adiciona um elemento ao final, construído com `args`.
+   *
+   * @return Referência ao novo elemento.
+   */
+  template <class... Args>
+  T& emplace_back(Args&&... args);
+
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Remove o último elemento. O vetor não pode estar vazio.
+   */
+  void pop_back();
+
+  /**
+   * @brief Remove o elemento da posição `index`, deslocando os seguintes.
+   *
+   * @throw std::out_of_range se `index >= size()`.
+   */
+  void erase(std::size_t index);
+
+  /**
+   * @brief Remove todos os elementos, mantendo a capacidade.
+   */
+  void clear();
+
+  std::size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  std::size_t capacity() const { return cap; }
+
+  /**
+   * @brief Indica se os elementos ainda estão no buffer interno.
+   */
+  bool is_inline() const { return heap == nullptr; }
+
+  T& operator[](std::size_t index) { return data()[index]; }
+  const T& operator[](std::size_t index) const { return data()[index]; }
+
+  T* data() { return heap ? heap : inline_data(); }
+  const T* data() const { return heap ? heap : inline_data(); }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + count; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + count; }
+
+ private:
+  // Sem `std::launder`: o buffer pode não conter nenhum objeto vivo, e o
+  // ponteiro só é usado como endereço de elementos criados por
+  // `std::construct_at`
+  T* inline_data() { return reinterpret_cast<T*>(storage); }
+  const T* inline_data() const {
+    return reinterpret_cast<const T*>(storage);
+  }
+
+  /**
+   * @brief Move os elementos para um buffer no heap com o dobro da
+   * capacidade.
+   */
+  void grow();
+
+  /**
+   * @brief Destrói os elementos e libera o heap, voltando ao estado vazio.
+   */
+  void reset();
+
+  /**
+   * @brief Assume os elementos de `other` (este vetor deve estar vazio e
+   * sem heap). O buffer do heap é transferido; elementos internos são
+   * movidos um a um.
+   */
+  void take(SmallVector&& other) noexcept;
+
+  alignas(T) std::byte storage[sizeof(T) * N];  ///< Buffer interno.
+  T* heap = nullptr;      ///< Buffer no heap, ou nullptr se interno.
+  std::size_t count = 0;  ///< Quantidade de elementos.
+  std::size_t cap = N;    ///< Capacidade do buffer em uso.
+};
+
+template <class T, std::size_t N>
+SmallVector<T, N>::SmallVector(const SmallVector& other) {
+  // O destrutor não roda se o construtor lançar exceção
+  try {
+    for (const T& value : other) {
+      emplace_back(value);
+    }
+  } catch (...) {
+    reset();
+    throw;
+  }
+}
+
+template <class T, std::size_t N>
+SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept {
+  take(std::move(other));
+}
+
+template <class T, std::size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other) {
+  if (this != &other) {
+    SmallVector copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <class T, std::size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept {
+  if (this != &other) {
+    reset();
+    take(std::move(other));
+  }
+  return *this;
+}
+
+template <class T, std::size_t N>
+SmallVector<T, N>::~SmallVector() {
+  reset();
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+T& SmallVector<T, N>::emplace_back(Args&&... args) {
+  if (count == cap) {
+    // Constrói antes de crescer: `args` pode referenciar um elemento atual
+    T value(std::forward<Args>(args)...);
+    grow();
+    T* slot = std::construct_at(data() + count, std::move(value));
+    ++count;
+    return *slot;
+  }
+  T* slot = std::construct_at(data() + count, std::forward<Args>(args)...);
+  ++count;
+  return *slot;
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::pop_back() {
+  std::destroy_at(data() + count - 1);
+  --count;
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::erase(std::size_t index) {
+  if (index >= count) {
+    throw std::out_of_range("SmallVector index out of range");
+  }
+  std::move(begin() + index + 1, end(), begin() + index);
+  pop_back();
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::clear() {
+  std::destroy(begin(), end());
+  count = 0;
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::grow() {
+  std::allocator<T> allocator;
+  std::size_t new_cap = cap * 2;
+  T* buffer = allocator.allocate(new_cap);
+  try {
+    std::uninitialized_move(begin(), end(), buffer);
+  } catch (...) {
+    allocator.deallocate(buffer, new_cap);
+    throw;
+  }
+  std::destroy(begin(), end());
+  if (heap != nullptr) allocator.deallocate(heap, cap);
+  heap = buffer;
+  cap = new_cap;
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::take(SmallVector&& other) noexcept {
+  if (!other.is_inline()) {
+    heap = std::exchange(other.heap, nullptr);
+    count = std::exchange(other.count, 0);
+    cap = std::exchange(other.cap, N);
+    return;
+  }
+  std::uninitialized_move(other.begin(), other.end(), inline_data());
+  count = other.count;
+  other.clear();
+}
+
+template <class T, std::size_t N>
+void SmallVector<T, N>::reset() {
+  clear();
+  if (heap != nullptr) {
+    std::allocator<T>().deallocate(heap, cap);
+    heap = nullptr;
+  }
+  cap = N;
+}
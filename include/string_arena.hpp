@@ -0,0 +1,112 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Região de memória somente de acréscimo para armazenar strings.
+ *
+ * As strings são copiadas, uma após a outra, para blocos grandes alocados
+ * sob demanda, e são acessadas por `std::string_view`. Isso troca uma
+ * alocação por string (e o cabeçalho de um `std::string`) por uma alocação a
+ * cada bloco, com as strings próximas na memória. O conteúdo de uma string
+ * nunca muda de endereço, nem quando a região é movida; a memória só é
+ * devolvida por `clear` ou pelo destrutor.
+ */
+class StringArena {
+ public:
+  /**
+   * @brief Cria uma região vazia.
+   *
+   * @param chunk_size Tamanho de cada bloco, em bytes. Strings maiores que
+   * um quarto do bloco recebem um bloco exclusivo.
+   */
+  explicit StringArena(std::size_t chunk_size = 64 * 1024)
+      : chunk_size(std::max<std::size_t>(chunk_size, 1)) {}
+
+  StringArena(StringArena&& other) noexcept;
+  StringArena& operator=(StringArena&& other) noexcept;
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  /**
+   * @brief Copia `text` para a região.
+   *
+   * @return Visão da cópia, válida até `clear` ou a destruição da região.
+   */
+  std::string_view intern(std::string_view text);
+
+  /**
+   * @brief Retorna a quantidade de bytes de strings armazenados.
+   */
+  std::size_t bytes() const { return used; }
+
+  /**
+   * @brief Libera todos os blocos, invalidando as visões já entregues.
+   */
+  void clear();
+
+ private:
+  std::vector<std::unique_ptr<char[]>> chunks;  ///< Blocos alocados.
+  char* cursor = nullptr;     ///< Próxima posição livre no bloco atual.
+  std::size_t remaining = 0;  ///< Bytes livres no bloco atual.
+  std::size_t chunk_size;     ///< Tamanho de um bloco comum.
+  std::size_t used = 0;       ///< Bytes de strings armazenados.
+};
+
+inline StringArena::StringArena(StringArena&& other) noexcept
+    : chunks(std::move(other.chunks)),
+      cursor(std::exchange(other.cursor, nullptr)),
+      remaining(std::exchange(other.remaining, 0)),
+      chunk_size(other.chunk_size),
+      used(std::exchange(other.used, 0)) {
+  other.chunks.clear();
+}
+
+inline StringArena& StringArena::operator=(StringArena&& other) noexcept {
+  if (this != &other) {
+    chunks = std::move(other.chunks);
+    other.chunks.clear();
+    cursor = std::exchange(other.cursor, nullptr);
+    remaining = std::exchange(other.remaining, 0);
+    chunk_size = other.chunk_size;
+    used = std::exchange(other.used, 0);
+  }
+  return *this;
+}
+
+inline std::string_view StringArena::intern(std::string_view text) {
+  if (text.empty()) return {};
+
+  char* target;
+  if (text.size() > chunk_size / 4) {
+    // String grande: bloco exclusivo, sem descartar o espaço do bloco atual
+    chunks.push_back(std::make_unique_for_overwrite<char[]>(text.size()));
+    target = chunks.back().get();
+  } else {
+    if (text.size() > remaining) {
+      chunks.push_back(std::make_unique_for_overwrite<char[]>(chunk_size));
+      cursor = chunks.back().get();
+      remaining = chunk_size;
+    }
+    target = cursor;
+    cursor += text.size();
+    remaining -= text.size();
+  }
+
+  std::memcpy(target, text.data(), text.size());
+  used += text.size();
+  return {target, text.size()};
+}
+
+inline void StringArena::clear() {
+  chunks.clear();
+  cursor = nullptr;
+  remaining = 0;
+  used = 0;
+}
@@ -0,0 +1,116 @@
+#include "../include/arena_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class ArenaMapTest : public ::testing::Test {
+ protected:
+  ArenaMap<int> words;
+};
+
+TEST_F(ArenaMapTest, IsEmptyInitially) {
+  EXPECT_EQ(words.size(), 0u);
+  EXPECT_EQ(words.arena_bytes(), 0u);
+  EXPECT_FALSE(words.contain("a"));
+}
+
+TEST_F(ArenaMapTest, InsertAndLookup) {
+  words["banana"] = 2;
+  words["apple"] = 1;
+  words[std::string("cherry")] = 3;
+  words["apple"] += 10;
+
+  EXPECT_EQ(words.size(), 3u);
+  EXPECT_EQ(words[std::string_view("apple")], 11);
+  EXPECT_TRUE(words.contain("cherry"));
+  EXPECT_EQ(words.arena_bytes(), 6u + 5u + 6u);
+
+  const auto& const_words = words;
+  EXPECT_EQ(const_words["banana"], 2);
+  EXPECT_THROW(const_words["durian"], std::out_of_range);
+}
+
+TEST_F(ArenaMapTest, KeysDoNotDependOnCallerStorage) {
+  {
+    std::string key = "temporary";
+    words[key] = 1;
+    key[0] = 'X';
+  }
+  EXPECT_TRUE(words.contain("temporary"));
+  EXPECT_EQ(words.in_order()[0].first, "temporary");
+}
+
+TEST_F(ArenaMapTest, InOrderIsSortedByKey) {
+  words["b"] = 2;
+  words["c"] = 3;
+  words["a"] = 1;
+  words[""] = 0;
+  std::vector<std::pair<std::string_view, int>> expected = {
+      {"", 0}, {"a", 1}, {"b", 2}, {"c", 3}};
+  EXPECT_EQ(words.in_order(), expected);
+}
+
+TEST_F(ArenaMapTest, RemoveAndCompact) {
+  for (int i = 0; i < 100; ++i) {
+    words["key" + std::to_string(i)] = i;
+  }
+  std::size_t before = words.arena_bytes();
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_TRUE(words.remove("key" + std::to_string(i)));
+  }
+  EXPECT_FALSE(words.remove("key0"));
+  EXPECT_EQ(words.arena_bytes(), before);
+
+  words.compact();
+  EXPECT_LT(words.arena_bytes(), before);
+  EXPECT_EQ(words.size(), 50u);
+  for (int i = 0; i < 100; ++i) {
+    std::string key = "key" + std::to_string(i);
+    EXPECT_EQ(words.contain(key), i % 2 == 1);
+    if (i % 2 == 1) {
+      EXPECT_EQ(words[key], i);
+    }
+  }
+}
+
+TEST_F(ArenaMapTest, CopyAndMove) {
+  words["a"] = 1;
+  ArenaMap<int> copy(words);
+  copy["b"] = 2;
+  words["a"] = 5;
+  EXPECT_EQ(copy["a"], 1);
+  EXPECT_FALSE(words.contain("b"));
+
+  ArenaMap<int> moved(std::move(copy));
+  EXPECT_EQ(moved["b"], 2);
+  words = moved;
+  EXPECT_EQ(words.size(), 2u);
+  EXPECT_EQ(words["a"], 1);
+}
+
+TEST(StringArenaTest, InternCopiesContiguously) {
+  StringArena arena(16);
+  std::string_view a = arena.intern("abc");
+  std::string_view b = arena.intern("de");
+  EXPECT_EQ(a, "abc");
+  EXPECT_EQ(b, "de");
+  EXPECT_EQ(b.data(), a.data() + a.size());
+  EXPECT_EQ(arena.bytes(), 5u);
+
+  // Maior que um quarto do bloco: bloco exclusivo
+  std::string_view big = arena.intern("0123456789");
+  EXPECT_EQ(big, "0123456789");
+  std::string_view c = arena.intern("f");
+  EXPECT_EQ(c.data(), b.data() + b.size());
+
+  StringArena moved(std::move(arena));
+  EXPECT_EQ(a, "abc");
+  EXPECT_EQ(moved.bytes(), 16u);
+  EXPECT_EQ(arena.bytes(), 0u);
+  EXPECT_EQ(arena.intern("g"), "g");
+}
@@ -1,5 +1,15 @@
 #include "../include/avl.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 using IntAVL = AVL<int>;
@@ -134,3 +144,625 @@ TEST(AVLRotationTest, RightLeftRotation) {
     EXPECT_EQ(tree.in_order(), expected);
     EXPECT_TRUE(tree.is_balanced());
 }
+
+// ---------- TRAVESSIAS PREGUIÇOSAS ----------
+
+TEST(AVLTest, LazyTraversalsMatchVectors) {
+    IntAVL tree;
+    for (int i = 1; i <= 100; ++i) {
+        tree.insert(i);
+    }
+
+    std::vector<int> in, pre, post;
+    for (int v : tree.lazy_in_order()) in.push_back(v);
+    for (int v : tree.lazy_pre_order()) pre.push_back(v);
+    for (int v : tree.lazy_post_order()) post.push_back(v);
+
+    EXPECT_EQ(in, tree.in_order());
+    EXPECT_EQ(pre, tree.pre_order());
+    EXPECT_EQ(post, tree.post_order());
+}
+
+TEST(AVLTest, LazyInOrderWithRangesViews) {
+    IntAVL tree;
+    for (int i = 1; i <= 20; ++i) {
+        tree.insert(i);
+    }
+
+    std::vector<int> evens;
+    for (int v : tree.lazy_in_order() |
+                     std::views::filter([](int x) { return x % 2 == 0; }) |
+                     std::views::take(3)) {
+        evens.push_back(v);
+    }
+    std::vector<int> expected = {2, 4, 6};
+    EXPECT_EQ(evens, expected);
+}
+
+TEST(AVLTest, LazyRangeVisitsHalfOpenInterval) {
+    IntAVL tree;
+    for (int i = 0; i < 40; i += 2) {
+        tree.insert(i);
+    }
+    tree.remove_lazy(10);
+
+    std::vector<int> values;
+    for (int v : tree.lazy_range(5, 15)) values.push_back(v);
+    EXPECT_EQ(values, (std::vector<int>{6, 8, 12, 14}));
+
+    values.clear();
+    for (int v : tree.lazy_range(30, 100)) values.push_back(v);
+    EXPECT_EQ(values, (std::vector<int>{30, 32, 34, 36, 38}));
+
+    values.clear();
+    for (int v : tree.lazy_range(7, 7)) values.push_back(v);
+    EXPECT_TRUE(values.empty());
+}
+
+// ---------- TAMANHO E EXPORTAÇÃO PARALELA ----------
+
+TEST(AVLTest, SizeTracksInsertAndRemove) {
+    IntAVL tree;
+    EXPECT_EQ(tree.size(), 0u);
+    for (int i = 0; i < 50; ++i) {
+        tree.insert(i);
+    }
+    tree.insert(10);  // Duplicado
+    EXPECT_EQ(tree.size(), 50u);
+    for (int i = 0; i < 50; i += 2) {
+        tree.remove(i);
+    }
+    tree.remove(1000);  // Inexistente
+    EXPECT_EQ(tree.size(), 25u);
+}
+
+TEST(AVLTest, ParallelInOrderMatchesInOrder) {
+    IntAVL tree;
+    for (int i = 0; i < 100000; ++i) {
+        tree.insert((i * 7919) % 100000);
+    }
+
+    std::vector<int> out(tree.size());
+    tree.parallel_in_order(std::span<int>(out));
+    EXPECT_EQ(out, tree.in_order());
+}
+
+TEST(AVLTest, ParallelInOrderRejectsSmallOutput) {
+    IntAVL tree;
+    tree.insert(1);
+    tree.insert(2);
+
+    std::vector<int> out(1);
+    EXPECT_THROW(tree.parallel_in_order(std::span<int>(out)),
+                 std::out_of_range);
+}
+
+// ---------- ALGORITMOS PARALELOS ----------
+
+TEST(AVLTest, ParallelForEachVisitsAll) {
+    IntAVL tree;
+    for (int i = 1; i <= 50000; ++i) {
+        tree.insert(i);
+    }
+
+    std::atomic<long long> sum{0};
+    tree.parallel_for_each([&](int v) { sum += v; });
+    EXPECT_EQ(sum.load(), 50000LL * 50001 / 2);
+}
+
+TEST(AVLTest, ParallelReducePreservesOrder) {
+    IntAVL tree;
+    for (int i = 1; i <= 50000; ++i) {
+        tree.insert(i);
+    }
+
+    long long sum = tree.parallel_reduce(
+        0LL, [](int v) { return static_cast<long long>(v); },
+        [](long long a, long long b) { return a + b; });
+    EXPECT_EQ(sum, 50000LL * 50001 / 2);
+
+    // Concatenação não é comutativa: verifica a ordem da redução
+    IntAVL small;
+    for (int i : {3, 1, 2}) {
+        small.insert(i);
+    }
+    std::string joined = small.parallel_reduce(
+        std::string(), [](int v) { return std::to_string(v); },
+        [](std::string a, const std::string& b) { return a + b; });
+    EXPECT_EQ(joined, "123");
+}
+
+TEST(AVLTest, FilterBuildsBalancedTree) {
+    IntAVL tree;
+    for (int i = 0; i < 50000; ++i) {
+        tree.insert(i);
+    }
+
+    IntAVL evens = tree.filter([](int v) { return v % 2 == 0; });
+    EXPECT_EQ(evens.size(), 25000u);
+    EXPECT_TRUE(evens.is_balanced());
+    EXPECT_TRUE(evens.contain(4242));
+    EXPECT_FALSE(evens.contain(4243));
+    EXPECT_EQ(tree.size(), 50000u);
+
+    // Seleções irregulares exercitam junções de alturas diferentes
+    IntAVL sparse = tree.filter([](int v) { return v < 100 || v % 997 == 0; });
+    EXPECT_TRUE(sparse.is_balanced());
+    std::vector<int> values = sparse.in_order();
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ(values.size(), sparse.size());
+}
+
+TEST(AVLTest, CopyAndMove) {
+    IntAVL tree;
+    for (int i : {20, 10, 30}) {
+        tree.insert(i);
+    }
+
+    IntAVL copy = tree;
+    copy.insert(40);
+    EXPECT_FALSE(tree.contain(40));
+    EXPECT_EQ(copy.pre_order().front(), tree.pre_order().front());
+
+    IntAVL moved = std::move(copy);
+    EXPECT_TRUE(moved.contain(40));
+    EXPECT_EQ(moved.size(), 4u);
+}
+
+// ---------- TRAVESSIA EM LARGURA ----------
+
+TEST(AVLTest, LevelOrderTraversal) {
+    IntAVL tree;
+    for (int i = 1; i <= 7; ++i) {
+        tree.insert(i);
+    }
+
+    std::vector<int> expected = {4, 2, 6, 1, 3, 5, 7};
+    EXPECT_EQ(tree.level_order(), expected);
+
+    std::vector<int> lazy;
+    for (int v : tree.lazy_level_order() | std::views::take(3)) {
+        lazy.push_back(v);
+    }
+    EXPECT_EQ(lazy, std::vector<int>({4, 2, 6}));
+}
+
+TEST(AVLTest, LevelOrderReloadsSameShape) {
+    IntAVL tree;
+    for (int i = 0; i < 1000; ++i) {
+        tree.insert((i * 37) % 1000);
+    }
+
+    IntAVL reloaded;
+    tree.level_order([&](int v) { reloaded.insert(v); });
+    EXPECT_EQ(reloaded.pre_order(), tree.pre_order());
+    EXPECT_TRUE(reloaded.is_balanced());
+}
+
+// ---------- OPERAÇÕES EM LOTE ----------
+
+TEST(AVLTest, InsertBatchMergesIntoTree) {
+    IntAVL tree;
+    for (int i = 0; i < 1000; i += 2) {
+        tree.insert(i);
+    }
+
+    std::vector<int> batch;
+    for (int i = 999; i >= 0; i -= 3) {
+        batch.push_back(i);
+    }
+    batch.push_back(3);  // Repetido no lote
+
+    std::size_t expected_new = 0;
+    for (int v : batch) {
+        if (v % 2 != 0 && v != 3) ++expected_new;
+    }
+    expected_new += 1;  // O 3 conta uma única vez
+
+    EXPECT_EQ(tree.insert_batch(batch), expected_new);
+    EXPECT_EQ(tree.size(), 500 + expected_new);
+    EXPECT_TRUE(tree.is_balanced());
+    std::vector<int> values = tree.in_order();
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ(values.size(), tree.size());
+    for (int v : batch) {
+        EXPECT_TRUE(tree.contain(v));
+    }
+}
+
+TEST(AVLTest, InsertBatchIntoEmptyAndLargeTrees) {
+    IntAVL tree;
+    std::vector<int> batch(20000);
+    for (int i = 0; i < 20000; ++i) {
+        batch[i] = (i * 7919) % 20000;
+    }
+    EXPECT_EQ(tree.insert_batch(batch), 20000u);
+    EXPECT_TRUE(tree.is_balanced());
+
+    EXPECT_EQ(tree.insert_batch(std::vector<int>{-1, 5, 20000}), 2u);
+    EXPECT_EQ(tree.size(), 20002u);
+    EXPECT_TRUE(tree.is_balanced());
+}
+
+TEST(AVLTest, RemoveBatch) {
+    IntAVL tree;
+    for (int i = 0; i < 20000; ++i) {
+        tree.insert(i);
+    }
+
+    std::vector<int> batch;
+    for (int i = 0; i < 30000; i += 3) {
+        batch.push_back(i);
+    }
+    EXPECT_EQ(tree.remove_batch(batch), 6667u);
+    EXPECT_EQ(tree.size(), 20000u - 6667u);
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_FALSE(tree.contain(300));
+    EXPECT_TRUE(tree.contain(301));
+
+    EXPECT_EQ(tree.remove_batch(std::vector<int>{}), 0u);
+    std::vector<int> rest = tree.in_order();
+    EXPECT_EQ(tree.remove_batch(rest), rest.size());
+    EXPECT_EQ(tree.size(), 0u);
+}
+
+TEST(AVLTest, InsertOrFindSingleDescent) {
+    IntAVL tree;
+    auto [node, inserted] = tree.insert_or_find(10);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(node->data, 10);
+
+    auto [same, again] = tree.insert_or_find(10);
+    EXPECT_FALSE(again);
+    EXPECT_EQ(same, node);
+    EXPECT_EQ(tree.size(), 1u);
+}
+
+TEST(AVLTest, RemoveKeepsOtherNodesInPlace) {
+    IntAVL tree;
+    for (int i = 0; i < 64; ++i) {
+        tree.insert(i);
+    }
+    std::vector<const IntAVL::TreeNode*> nodes;
+    for (int i = 0; i < 64; ++i) {
+        nodes.push_back(tree.find_node(i));
+    }
+    // Remove nós internos, que têm dois filhos
+    for (int i = 0; i < 64; i += 3) {
+        EXPECT_TRUE(tree.remove(i));
+    }
+    for (int i = 0; i < 64; ++i) {
+        if (i % 3 == 0) continue;
+        EXPECT_EQ(tree.find_node(i), nodes[i]);
+        EXPECT_EQ(nodes[i]->data, i);
+    }
+}
+
+// ---------- EXTREMOS ----------
+
+TEST(AVLTest, TopKAndBottomK) {
+    IntAVL tree;
+    for (int i = 1; i <= 100; ++i) {
+        tree.insert((i * 37) % 101);
+    }
+
+    EXPECT_EQ(tree.bottom_k(3), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(tree.top_k(3), std::vector<int>({100, 99, 98}));
+    EXPECT_TRUE(tree.top_k(0).empty());
+    EXPECT_EQ(tree.bottom_k(500), tree.in_order());
+}
+
+// ---------- ESTATÍSTICAS DE ORDEM E AMOSTRAGEM ----------
+
+TEST(AVLTest, SelectByRank) {
+    IntAVL tree;
+    for (int i = 0; i < 1000; ++i) {
+        tree.insert((i * 37) % 1000);
+    }
+    for (std::size_t rank = 0; rank < 1000; rank += 111) {
+        EXPECT_EQ(tree.select(rank), static_cast<int>(rank));
+    }
+    EXPECT_THROW(tree.select(1000), std::out_of_range);
+}
+
+TEST(AVLTest, SampleIsUniformAndDistinct) {
+    IntAVL tree;
+    for (int i = 0; i < 10; ++i) {
+        tree.insert(i);
+    }
+
+    std::mt19937_64 gen(42);
+    std::vector<int> hits(10, 0);
+    for (int i = 0; i < 10000; ++i) {
+        ++hits[tree.sample(gen)];
+    }
+    for (int h : hits) {
+        EXPECT_GT(h, 800);
+        EXPECT_LT(h, 1200);
+    }
+
+    std::vector<int> picked = tree.sample(4, gen);
+    EXPECT_EQ(picked.size(), 4u);
+    EXPECT_TRUE(std::is_sorted(picked.begin(), picked.end()));
+    EXPECT_TRUE(std::adjacent_find(picked.begin(), picked.end()) ==
+                picked.end());
+    EXPECT_EQ(tree.sample(50), tree.in_order());
+
+    IntAVL empty;
+    EXPECT_THROW(empty.sample(), std::out_of_range);
+    EXPECT_TRUE(empty.sample(3).empty());
+}
+
+TEST(AVLTest, RankCountsSmallerValues) {
+    IntAVL tree;
+    for (int i = 0; i < 100; i += 10) {
+        tree.insert(i);
+    }
+    EXPECT_EQ(tree.rank(-5), 0u);
+    EXPECT_EQ(tree.rank(0), 0u);
+    EXPECT_EQ(tree.rank(35), 4u);
+    EXPECT_EQ(tree.rank(40), 4u);
+    EXPECT_EQ(tree.rank(1000), 10u);
+}
+
+TEST(AVLTest, ArithmeticLookupMatchesInsertedValues) {
+    AVL<long long> tree;
+    std::vector<long long> values;
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 2000; ++i) {
+        long long v = static_cast<long long>(rng() % 100000) - 50000;
+        if (tree.insert(v)) values.push_back(v);
+    }
+
+    for (long long v : values) {
+        EXPECT_TRUE(tree.contain(v));
+        auto* node = tree.find_node(v);
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->data, v);
+    }
+
+    std::ranges::sort(values);
+    for (long long v = -50001; v <= 50000; v += 97) {
+        EXPECT_EQ(tree.contain(v), std::ranges::binary_search(values, v));
+    }
+}
+
+TEST(AVLTest, InsertTopDownMatchesInsert) {
+    IntAVL top_down;
+    IntAVL recursive;
+    std::mt19937 rng(11);
+    for (int i = 0; i < 3000; ++i) {
+        int v = static_cast<int>(rng() % 1000);
+        EXPECT_EQ(top_down.insert_top_down(v), recursive.insert(v));
+        if (i % 5 == 0) {
+            int r = static_cast<int>(rng() % 1000);
+            EXPECT_EQ(top_down.remove(r), recursive.remove(r));
+        }
+    }
+    EXPECT_TRUE(top_down.is_balanced());
+    EXPECT_EQ(top_down.in_order(), recursive.in_order());
+    ASSERT_EQ(top_down.size(), recursive.size());
+    for (std::size_t i = 0; i < top_down.size(); ++i) {
+        EXPECT_EQ(top_down.select(i), recursive.select(i));
+    }
+}
+
+TEST(AVLTest, InsertTopDownKeepsBalanceOnSortedInput) {
+    IntAVL tree;
+    for (int i = 0; i < 1024; ++i) {
+        EXPECT_TRUE(tree.insert_top_down(i));
+        EXPECT_FALSE(tree.insert_top_down(i));
+    }
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_EQ(tree.size(), 1024u);
+    EXPECT_EQ(tree.rank(512), 512u);
+    for (int i = 1023; i >= 0; i -= 2) {
+        EXPECT_TRUE(tree.remove(i));
+    }
+    for (int i = -1; i >= -500; --i) {
+        EXPECT_TRUE(tree.insert_top_down(i));
+    }
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_EQ(tree.size(), 1012u);
+    EXPECT_EQ(tree.select(0), -500);
+}
+
+TEST(AVLTest, RemoveLazyHidesValuesWithoutReshaping) {
+    IntAVL tree;
+    for (int i = 0; i < 64; ++i) {
+        tree.insert(i);
+    }
+    std::vector<int> shape = tree.pre_order();
+
+    for (int i = 0; i < 64; i += 4) {
+        EXPECT_TRUE(tree.remove_lazy(i));
+    }
+    EXPECT_FALSE(tree.remove_lazy(0));
+    EXPECT_FALSE(tree.remove_lazy(100));
+    EXPECT_FALSE(tree.remove(0));
+    EXPECT_EQ(tree.tombstones(), 16u);
+    EXPECT_EQ(tree.size(), 48u);
+
+    // O formato não muda: a pré-ordem apenas omite os marcados
+    std::vector<int> expected;
+    std::ranges::copy_if(shape, std::back_inserter(expected),
+                         [](int v) { return v % 4 != 0; });
+    EXPECT_EQ(tree.pre_order(), expected);
+
+    EXPECT_FALSE(tree.contain(8));
+    EXPECT_EQ(tree.find_node(8), nullptr);
+    EXPECT_TRUE(tree.contain(9));
+    EXPECT_EQ(tree.select(0), 1);
+    EXPECT_EQ(tree.select(3), 5);
+    EXPECT_EQ(tree.rank(8), 6u);
+    EXPECT_EQ(tree.rank(9), 6u);
+    EXPECT_EQ(tree.bottom_k(3), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(tree.top_k(2), (std::vector<int>{63, 62}));
+
+    std::vector<int> lazy;
+    for (int v : tree.lazy_in_order()) lazy.push_back(v);
+    EXPECT_EQ(lazy, tree.in_order());
+    std::vector<int> out(tree.size());
+    tree.parallel_in_order(std::span<int>(out));
+    EXPECT_EQ(out, tree.in_order());
+    EXPECT_EQ(tree.parallel_reduce(0, [](int v) { return v; }, std::plus<>()),
+              64 * 63 / 2 - 4 * (16 * 15 / 2));
+
+    // Reinserir reaproveita o nó marcado
+    EXPECT_TRUE(tree.insert(8));
+    EXPECT_FALSE(tree.insert(8));
+    EXPECT_TRUE(tree.insert_top_down(12));
+    EXPECT_EQ(tree.tombstones(), 14u);
+    EXPECT_EQ(tree.size(), 50u);
+    EXPECT_EQ(tree.pre_order().size(), 50u);
+    EXPECT_TRUE(tree.is_balanced());
+}
+
+TEST(AVLTest, RemoveLazyPurgesAboveThreshold) {
+    IntAVL tree;
+    for (int i = 0; i < 100; ++i) {
+        tree.insert(i);
+    }
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_TRUE(tree.remove_lazy(i));
+    }
+    EXPECT_EQ(tree.tombstones(), 50u);
+
+    // Mais marcas que valores: a árvore é reconstruída
+    auto* kept = tree.find_node(99);
+    EXPECT_TRUE(tree.remove_lazy(50));
+    EXPECT_EQ(tree.tombstones(), 0u);
+    EXPECT_EQ(tree.size(), 49u);
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_EQ(tree.find_node(99), kept);
+    EXPECT_EQ(tree.select(0), 51);
+
+    IntAVL copy = tree;
+    copy.remove_lazy(60);
+    copy.purge();
+    EXPECT_EQ(copy.tombstones(), 0u);
+    EXPECT_EQ(copy.size(), 48u);
+    EXPECT_FALSE(copy.contain(60));
+    EXPECT_TRUE(tree.contain(60));
+}
+
+TEST(AVLTest, RemoveLazyMatchesRemove) {
+    IntAVL lazy;
+    IntAVL eager;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 4000; ++i) {
+        int v = static_cast<int>(rng() % 500);
+        switch (rng() % 4) {
+            case 0:
+                EXPECT_EQ(lazy.remove_lazy(v), eager.remove(v));
+                break;
+            case 1:
+                EXPECT_EQ(lazy.remove(v), eager.remove(v));
+                break;
+            default:
+                EXPECT_EQ(lazy.insert(v), eager.insert(v));
+        }
+        ASSERT_EQ(lazy.size(), eager.size());
+    }
+    EXPECT_TRUE(lazy.is_balanced());
+    EXPECT_EQ(lazy.in_order(), eager.in_order());
+
+    // As operações em lote descartam as marcas antes de dividir a árvore
+    std::vector<int> batch = {1, 2, 3, 600, 601};
+    EXPECT_EQ(lazy.insert_batch(batch), eager.insert_batch(batch));
+    EXPECT_EQ(lazy.tombstones(), 0u);
+    EXPECT_EQ(lazy.in_order(), eager.in_order());
+}
+
+TEST(AVLTest, EagerRemoveAlsoPurgesTombstones) {
+    IntAVL tree;
+    for (int i = 1; i <= 3; ++i) {
+        tree.insert(i);
+    }
+    EXPECT_TRUE(tree.remove_lazy(1));
+    EXPECT_TRUE(tree.remove(2));
+    EXPECT_TRUE(tree.remove(3));
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_EQ(tree.tombstones(), 0u);
+    EXPECT_THROW(tree.sample(), std::out_of_range);
+    EXPECT_TRUE(tree.in_order().empty());
+}
+
+TEST(AVLTest, SampleRejectsTreeWithOnlyTombstones) {
+    IntAVL tree;
+    tree.insert(1);
+    tree.insert(2);
+    EXPECT_TRUE(tree.remove_lazy(1));
+    EXPECT_EQ(tree.tombstones(), 1u);
+    EXPECT_TRUE(tree.remove_lazy(2));
+    EXPECT_EQ(tree.size(), 0u);
+    EXPECT_THROW(tree.sample(), std::out_of_range);
+}
+
+// Valor que pode ser copiado, mas não atribuído
+struct Frozen {
+    const int id;
+    bool operator<(const Frozen& other) const { return id < other.id; }
+};
+
+TEST(AVLTest, ReinsertAfterRemoveLazyNeedsNoAssignment) {
+    AVL<Frozen> tree;
+    for (int i = 0; i < 8; ++i) {
+        tree.insert(Frozen{i});
+    }
+    EXPECT_TRUE(tree.remove_lazy(Frozen{3}));
+    EXPECT_TRUE(tree.insert(Frozen{3}));
+    EXPECT_TRUE(tree.remove_lazy(Frozen{5}));
+    EXPECT_TRUE(tree.insert_top_down(Frozen{5}));
+    EXPECT_EQ(tree.tombstones(), 0u);
+    EXPECT_EQ(tree.size(), 8u);
+    EXPECT_EQ(tree.select(5).id, 5);
+    EXPECT_TRUE(tree.is_balanced());
+}
+
+// Valor cuja cópia lança exceção quando `armed` está ligado
+struct FragileCopy {
+    static inline bool armed = false;
+    int id;
+
+    explicit FragileCopy(int i) : id(i) {}
+    FragileCopy(const FragileCopy& other) : id(other.id) {
+        if (armed) throw std::runtime_error("copy failed");
+    }
+    bool operator<(const FragileCopy& other) const { return id < other.id; }
+};
+
+TEST(AVLTest, InsertTopDownLeavesTreeIntactOnThrow) {
+    AVL<FragileCopy> tree;
+    for (int i = 0; i < 100; ++i) {
+        tree.insert_top_down(FragileCopy(i * 2));
+    }
+
+    FragileCopy value(51);
+    FragileCopy::armed = true;
+    EXPECT_THROW(tree.insert_top_down(value), std::runtime_error);
+    EXPECT_THROW(tree.insert_top_down(FragileCopy(1000)), std::runtime_error);
+    FragileCopy::armed = false;
+
+    EXPECT_EQ(tree.size(), 100u);
+    EXPECT_EQ(tree.in_order().size(), 100u);
+    EXPECT_EQ(tree.rank(FragileCopy(51)), 26u);
+    EXPECT_EQ(tree.select(99).id, 198);
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_TRUE(tree.insert_top_down(value));
+    EXPECT_EQ(tree.size(), 101u);
+}
+
+TEST(AVLTest, SelectKByCustomOrder) {
+    IntAVL tree;
+    for (int v : {7, -3, 12, 5, -9, 1}) {
+        tree.insert(v);
+    }
+    // Menores valores absolutos primeiro
+    auto closer = [](int a, int b) { return std::abs(a) < std::abs(b); };
+    std::vector<int> selected;
+    for (const int* v : tree.select_k(3, closer)) selected.push_back(*v);
+    EXPECT_EQ(selected, (std::vector<int>{1, -3, 5}));
+    EXPECT_TRUE(tree.select_k(0, closer).empty());
+    EXPECT_EQ(tree.select_k(10, closer).size(), 6u);
+}
@@ -0,0 +1,157 @@
+#include "../include/bimap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+class BiMapTest : public ::testing::Test {
+ protected:
+  BiMap<int, std::string> names;
+};
+
+TEST_F(BiMapTest, IsEmptyInitially) {
+  EXPECT_EQ(names.size(), 0u);
+  EXPECT_EQ(names.find_value(1), nullptr);
+  EXPECT_EQ(names.find_key("a"), nullptr);
+}
+
+TEST_F(BiMapTest, LookupBothDirections) {
+  EXPECT_TRUE(names.insert(1, "one"));
+  EXPECT_TRUE(names.insert(2, "two"));
+  EXPECT_TRUE(names.insert(3, "three"));
+
+  ASSERT_NE(names.find_value(2), nullptr);
+  EXPECT_EQ(*names.find_value(2), "two");
+  ASSERT_NE(names.find_key("three"), nullptr);
+  EXPECT_EQ(*names.find_key("three"), 3);
+  EXPECT_TRUE(names.contain_key(1));
+  EXPECT_TRUE(names.contain_value("one"));
+  EXPECT_FALSE(names.contain_value("four"));
+  EXPECT_EQ(names.size(), 3u);
+}
+
+TEST_F(BiMapTest, RejectsDuplicateKeyOrValue) {
+  EXPECT_TRUE(names.insert(1, "one"));
+  EXPECT_FALSE(names.insert(1, "uno"));
+  EXPECT_FALSE(names.insert(9, "one"));
+  EXPECT_EQ(names.size(), 1u);
+  EXPECT_EQ(*names.find_value(1), "one");
+  EXPECT_EQ(names.find_key("uno"), nullptr);
+  EXPECT_EQ(names.find_value(9), nullptr);
+}
+
+TEST_F(BiMapTest, RemoveFromEitherSide) {
+  names.insert(1, "one");
+  names.insert(2, "two");
+  EXPECT_TRUE(names.remove_key(1));
+  EXPECT_FALSE(names.contain_value("one"));
+  EXPECT_TRUE(names.remove_value("two"));
+  EXPECT_FALSE(names.contain_key(2));
+  EXPECT_FALSE(names.remove_key(1));
+  EXPECT_FALSE(names.remove_value("two"));
+  EXPECT_EQ(names.size(), 0u);
+
+  // Chave e valor podem ser reutilizados depois da remoção
+  EXPECT_TRUE(names.insert(1, "two"));
+}
+
+TEST_F(BiMapTest, InOrderByKey) {
+  names.insert(3, "a");
+  names.insert(1, "c");
+  names.insert(2, "b");
+  EXPECT_EQ(names.in_order(),
+            (std::vector<std::pair<int, std::string>>{
+                {1, "c"}, {2, "b"}, {3, "a"}}));
+}
+
+TEST_F(BiMapTest, CopyAndMove) {
+  names.insert(1, "one");
+  BiMap<int, std::string> copy(names);
+  copy.insert(2, "two");
+  EXPECT_EQ(names.size(), 1u);
+  EXPECT_EQ(*copy.find_key("one"), 1);
+
+  BiMap<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 2u);
+  names = moved;
+  EXPECT_EQ(*names.find_key("two"), 2);
+}
+
+TEST_F(BiMapTest, ManyInsertionsAndRemovals) {
+  BiMap<int, int> inverse;
+  const int n = 2000;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_TRUE(inverse.insert(i, n - i));
+  }
+  for (int i = 0; i < n; i += 3) {
+    ASSERT_TRUE(i % 2 ? inverse.remove_key(i) : inverse.remove_value(n - i));
+  }
+  for (int i = 0; i < n; ++i) {
+    const int* key = inverse.find_key(n - i);
+    if (i % 3 == 0) {
+      EXPECT_EQ(key, nullptr);
+      EXPECT_EQ(inverse.find_value(i), nullptr);
+    } else {
+      ASSERT_NE(key, nullptr);
+      EXPECT_EQ(*key, i);
+      EXPECT_EQ(*inverse.find_value(i), n - i);
+    }
+  }
+  EXPECT_EQ(inverse.size(), static_cast<std::size_t>(n - (n + 2) / 3));
+}
+
+// Valor que conta as instâncias vivas e cuja cópia ou comparação pode
+// falhar
+struct Tracked {
+  static inline int alive = 0;
+  static inline int copies_left = -1;  // Negativo: sem limite
+  static inline bool fragile_compare = false;
+  int id;
+
+  explicit Tracked(int i) : id(i) { ++alive; }
+  Tracked(const Tracked& other) : id(other.id) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+    ++alive;
+  }
+  ~Tracked() { --alive; }
+
+  bool operator<(const Tracked& other) const {
+    if (fragile_compare) throw std::runtime_error("compare failed");
+    return id < other.id;
+  }
+};
+
+TEST(BiMapFailureTest, FailedCopyReleasesPartialEntries) {
+  {
+    BiMap<int, Tracked> source;
+    for (int i = 0; i < 10; ++i) source.insert(i, Tracked(i));
+    EXPECT_EQ(Tracked::alive, 10);
+
+    Tracked::copies_left = 4;
+    using Map = BiMap<int, Tracked>;
+    EXPECT_THROW(Map copy(source), std::runtime_error);
+    Tracked::copies_left = -1;
+    EXPECT_EQ(Tracked::alive, 10);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(BiMapFailureTest, FailedInsertLeavesBothIndexes) {
+  BiMap<int, Tracked> map;
+  map.insert(1, Tracked(10));
+
+  Tracked::fragile_compare = true;
+  EXPECT_THROW(map.insert(2, Tracked(20)), std::runtime_error);
+  Tracked::fragile_compare = false;
+
+  EXPECT_EQ(map.size(), 1u);
+  EXPECT_FALSE(map.contain_key(2));
+  EXPECT_TRUE(map.insert(2, Tracked(20)));
+  EXPECT_EQ(*map.find_key(Tracked(20)), 2);
+  EXPECT_TRUE(map.remove_key(2));
+  EXPECT_EQ(Tracked::alive, 1);
+}
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <ranges>
+#include <vector>
+
 // ---------- Casos Gerais ----------
 
 TEST(BSTTest, InserirEEncontrarElementos) {
@@ -180,4 +183,79 @@ TEST(BSTTest, PostOrderTraversal) {
   std::vector<int> expected = {3, 7, 5, 15, 10};
 
   EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+
+// ---------- Travessias Preguiçosas ----------
+
+TEST(BSTTest, LazyTraversalsMatchVectors) {
+  BST<int> tree;
+  for (int v : {10, 5, 15, 3, 7, 12, 18}) {
+    tree.insert(v);
+  }
+
+  std::vector<int> in, pre, post;
+  for (int v : tree.lazy_in_order()) in.push_back(v);
+  for (int v : tree.lazy_pre_order()) pre.push_back(v);
+  for (int v : tree.lazy_post_order()) post.push_back(v);
+
+  EXPECT_EQ(in, tree.in_order());
+  EXPECT_EQ(pre, tree.pre_order());
+  EXPECT_EQ(post, tree.post_order());
+}
+
+TEST(BSTTest, LazyTraversalEmptyTree) {
+  BST<int> tree;
+  auto gen = tree.lazy_in_order();
+  EXPECT_TRUE(gen.begin() == gen.end());
+}
+
+TEST(BSTTest, LazyPreOrderStopsEarlyWithRanges) {
+  BST<int> tree;
+  for (int v : {10, 5, 15, 3, 7}) {
+    tree.insert(v);
+  }
+
+  std::vector<int> prefix;
+  for (int v : tree.lazy_pre_order() | std::views::take(3)) {
+    prefix.push_back(v);
+  }
+  std::vector<int> expected = {10, 5, 3};
+  EXPECT_EQ(prefix, expected);
+}
+
+TEST(BSTTest, LevelOrderTraversal) {
+  BST<int> tree;
+  for (int v : {10, 5, 15, 3, 7, 18}) {
+    tree.insert(v);
+  }
+
+  std::vector<int> expected = {10, 5, 15, 3, 7, 18};
+  EXPECT_EQ(tree.level_order(), expected);
+
+  std::vector<int> visited;
+  tree.level_order([&](int v) { visited.push_back(v); });
+  EXPECT_EQ(visited, expected);
+
+  std::vector<int> lazy;
+  for (int v : tree.lazy_level_order()) lazy.push_back(v);
+  EXPECT_EQ(lazy, expected);
+
+  // Reinserir em ordem de nível reproduz o mesmo formato
+  BST<int> copy;
+  for (int v : tree.level_order()) copy.insert(v);
+  EXPECT_EQ(copy.pre_order(), tree.pre_order());
+}
+
+TEST(BSTTest, ArithmeticLookupMatchesInsertedValues) {
+  BST<double> tree;
+  for (double v : {0.5, -2.25, 7.0, 3.5, -0.0, 10.75}) {
+    tree.insert(v);
+  }
+
+  for (double v : {0.5, -2.25, 7.0, 3.5, 0.0, 10.75}) {
+    EXPECT_TRUE(tree.contain(v));
+  }
+  for (double v : {0.25, -3.0, 7.5, 11.0}) {
+    EXPECT_FALSE(tree.contain(v));
+  }
+}
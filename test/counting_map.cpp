@@ -0,0 +1,103 @@
+#include "../include/counting_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class CountingMapTest : public ::testing::Test {
+ protected:
+  CountingMap<std::string> words;
+  CountingMap<int, int> events;
+};
+
+TEST_F(CountingMapTest, IsEmptyInitially) {
+  EXPECT_EQ(words.size(), 0u);
+  EXPECT_EQ(words.count("a"), 0u);
+  EXPECT_TRUE(words.top_k(3).empty());
+}
+
+TEST_F(CountingMapTest, IncrementNewAndExisting) {
+  EXPECT_EQ(words.increment("a"), 1u);
+  EXPECT_EQ(words.increment("a"), 2u);
+  EXPECT_EQ(words.increment("b", 5), 5u);
+  EXPECT_EQ(words.count("a"), 2u);
+  EXPECT_EQ(words.count("b"), 5u);
+  EXPECT_EQ(words.size(), 2u);
+
+  EXPECT_EQ(events.increment(7, -2), -2);
+  EXPECT_EQ(events.increment(7, 3), 1);
+}
+
+TEST_F(CountingMapTest, Remove) {
+  words.increment("a");
+  EXPECT_TRUE(words.remove("a"));
+  EXPECT_FALSE(words.remove("a"));
+  EXPECT_EQ(words.count("a"), 0u);
+}
+
+TEST_F(CountingMapTest, IncrementBatchGroupsRepeats) {
+  words.increment("the", 10);
+  std::vector<std::string> text = {"the", "cat", "saw", "the", "cat", "the"};
+  EXPECT_EQ(words.increment_batch(text), 2u);  // "cat" e "saw"
+  EXPECT_EQ(words.count("the"), 13u);
+  EXPECT_EQ(words.count("cat"), 2u);
+  EXPECT_EQ(words.count("saw"), 1u);
+  EXPECT_EQ(words.size(), 3u);
+}
+
+TEST_F(CountingMapTest, TopK) {
+  for (int key = 0; key < 100; ++key) {
+    events.increment(key, key % 10);
+  }
+
+  auto top = events.top_k(3);
+  std::vector<std::pair<int, int>> expected = {{9, 9}, {19, 9}, {29, 9}};
+  EXPECT_EQ(top, expected);
+
+  EXPECT_EQ(events.top_k(0).size(), 0u);
+  EXPECT_EQ(events.top_k(1000).size(), 100u);
+}
+
+// Chave que conta as próprias construções
+struct CountedWord {
+  static inline int constructions = 0;
+  std::string text;
+
+  explicit CountedWord(std::string t) : text(std::move(t)) { ++constructions; }
+  CountedWord(const CountedWord& other) : text(other.text) { ++constructions; }
+  CountedWord& operator=(const CountedWord&) = default;
+
+  bool operator<(const CountedWord& other) const { return text < other.text; }
+  friend bool operator<(const CountedWord& w, std::string_view s) {
+    return w.text < s;
+  }
+  friend bool operator<(std::string_view s, const CountedWord& w) {
+    return s < w.text;
+  }
+};
+
+TEST(CountingMapProbeTest, LookupsCopyNoKey) {
+  CountingMap<CountedWord> counts;
+  const CountedWord the("the");
+  counts.increment(the);
+
+  int before = CountedWord::constructions;
+  EXPECT_EQ(counts.increment(the, 2), 3u);
+  EXPECT_EQ(counts.count(the), 3u);
+  EXPECT_EQ(counts.count(std::string_view("the")), 3u);
+  EXPECT_EQ(counts.count(std::string_view("cat")), 0u);
+  EXPECT_TRUE(counts.remove(std::string_view("the")));
+  EXPECT_FALSE(counts.remove(the));
+  EXPECT_EQ(CountedWord::constructions, before);
+}
+
+TEST_F(CountingMapTest, StringViewLookups) {
+  words.increment("word", 4);
+  std::string_view text = "a word";
+  EXPECT_EQ(words.count(text.substr(2)), 4u);
+  EXPECT_TRUE(words.remove(text.substr(2)));
+  EXPECT_EQ(words.size(), 0u);
+}
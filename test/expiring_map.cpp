@@ -0,0 +1,163 @@
+#include "../include/expiring_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+using namespace std::chrono_literals;
+
+class ExpiringMapTest : public ::testing::Test {
+ protected:
+  using Sessions = ExpiringMap<std::string, int>;
+  using time_point = Sessions::time_point;
+
+  Sessions sessions;
+  const time_point start{};
+};
+
+TEST_F(ExpiringMapTest, IsEmptyInitially) {
+  EXPECT_EQ(sessions.size(), 0u);
+  EXPECT_EQ(sessions.find("a", start), nullptr);
+  EXPECT_EQ(sessions.expire(start + 1h), 0u);
+}
+
+TEST_F(ExpiringMapTest, FindHidesExpiredEntries) {
+  EXPECT_TRUE(sessions.insert("a", 1, start + 10s));
+  ASSERT_NE(sessions.find("a", start + 9s), nullptr);
+  EXPECT_EQ(*sessions.find("a", start + 9s), 1);
+  EXPECT_EQ(sessions.find("a", start + 10s), nullptr);
+  // Ainda ocupa espaço até `expire`
+  EXPECT_EQ(sessions.size(), 1u);
+}
+
+TEST_F(ExpiringMapTest, ReinsertRefreshesDeadline) {
+  sessions.insert("a", 1, start + 10s);
+  EXPECT_FALSE(sessions.insert("a", 2, start + 30s));
+  EXPECT_EQ(*sessions.find("a", start + 20s), 2);
+  EXPECT_EQ(*sessions.deadline("a"), start + 30s);
+
+  EXPECT_EQ(sessions.expire(start + 20s), 0u);
+  EXPECT_EQ(sessions.size(), 1u);
+}
+
+TEST_F(ExpiringMapTest, InsertFor) {
+  sessions.insert_for("a", 1, 5s, start);
+  EXPECT_EQ(*sessions.deadline("a"), start + 5s);
+  EXPECT_NE(sessions.find("a", start + 4s), nullptr);
+
+  sessions.insert_for("b", 2, 1h);
+  EXPECT_NE(sessions.find("b"), nullptr);
+}
+
+TEST_F(ExpiringMapTest, ExpireRemovesOnlyStaleEntries) {
+  sessions.insert("a", 1, start + 3s);
+  sessions.insert("b", 2, start + 1s);
+  sessions.insert("c", 3, start + 2s);
+  sessions.insert("d", 4, start + 2s);
+  sessions.insert("e", 5, start + 9s);
+
+  EXPECT_EQ(sessions.expire(start + 2s), 3u);
+  EXPECT_EQ(sessions.size(), 2u);
+  EXPECT_EQ(sessions.deadline("b"), nullptr);
+  EXPECT_EQ(sessions.deadline("c"), nullptr);
+  EXPECT_EQ(sessions.deadline("d"), nullptr);
+  EXPECT_EQ(*sessions.find("a", start + 2s), 1);
+
+  EXPECT_EQ(sessions.expire(start + 10s), 2u);
+  EXPECT_EQ(sessions.size(), 0u);
+}
+
+TEST_F(ExpiringMapTest, RemoveDropsDeadline) {
+  sessions.insert("a", 1, start + 1s);
+  EXPECT_TRUE(sessions.remove("a"));
+  EXPECT_FALSE(sessions.remove("a"));
+  EXPECT_EQ(sessions.expire(start + 1h), 0u);
+}
+
+TEST_F(ExpiringMapTest, ManyEntries) {
+  ExpiringMap<int, int> cache;
+  for (int i = 0; i < 1000; ++i) {
+    cache.insert(i, i, start + std::chrono::seconds((i * 7) % 100));
+  }
+  EXPECT_EQ(cache.expire(start + 49s), 500u);
+  for (int i = 0; i < 1000; ++i) {
+    bool alive = (i * 7) % 100 > 49;
+    EXPECT_EQ(cache.find(i, start + 49s) != nullptr, alive);
+  }
+}
+
+// Valor sem construtor padrão que conta as próprias construções
+struct Token {
+  static inline int constructions = 0;
+  int id;
+
+  explicit Token(int i) : id(i) { ++constructions; }
+  Token(const Token& other) : id(other.id) { ++constructions; }
+  Token& operator=(const Token&) = default;
+};
+
+TEST(ExpiringMapProbeTest, LookupsConstructNoValue) {
+  using Tokens = ExpiringMap<int, Token>;
+  const Tokens::time_point start{};
+  Tokens tokens;
+  tokens.insert(1, Token(10), start + 5s);
+  tokens.insert(2, Token(20), start + 1s);
+
+  int before = Token::constructions;
+  ASSERT_NE(tokens.find(1, start), nullptr);
+  EXPECT_EQ(tokens.find(1, start)->id, 10);
+  EXPECT_EQ(tokens.find(3, start), nullptr);
+  EXPECT_NE(tokens.deadline(2), nullptr);
+  EXPECT_EQ(tokens.expire(start + 2s), 1u);
+  EXPECT_TRUE(tokens.remove(1));
+  EXPECT_FALSE(tokens.remove(1));
+  EXPECT_EQ(Token::constructions, before);
+  EXPECT_EQ(tokens.size(), 0u);
+}
+
+TEST(ExpiringMapProbeTest, ReinsertCopiesValueOnlyIntoEntry) {
+  using Tokens = ExpiringMap<int, Token>;
+  const Tokens::time_point start{};
+  Tokens tokens;
+  tokens.insert(1, Token(10), start + 5s);
+
+  Token fresh(11);
+  int before = Token::constructions;
+  EXPECT_FALSE(tokens.insert(1, fresh, start + 7s));
+  EXPECT_EQ(Token::constructions, before);
+  EXPECT_EQ(tokens.find(1, start)->id, 11);
+  EXPECT_EQ(*tokens.deadline(1), start + 7s);
+}
+
+// Valor cuja atribuição pode falhar sob demanda
+struct Brittle {
+  static inline bool fail = false;
+  int id;
+
+  explicit Brittle(int i) : id(i) {}
+  Brittle(const Brittle&) = default;
+  Brittle& operator=(const Brittle& other) {
+    if (fail) throw std::runtime_error("assignment failed");
+    id = other.id;
+    return *this;
+  }
+};
+
+TEST(ExpiringMapFailureTest, ThrowingReinsertKeepsDeadline) {
+  using Brittles = ExpiringMap<int, Brittle>;
+  const Brittles::time_point start{};
+  Brittles map;
+  map.insert(1, Brittle(1), start + 5s);
+
+  Brittle::fail = true;
+  EXPECT_THROW(map.insert(1, Brittle(2), start + 50s), std::runtime_error);
+  EXPECT_THROW(map.insert(1, Brittle(3), start + 5s), std::runtime_error);
+  Brittle::fail = false;
+
+  EXPECT_EQ(map.find(1, start)->id, 1);
+  EXPECT_EQ(*map.deadline(1), start + 5s);
+  EXPECT_EQ(map.expire(start + 100s), 1u);
+  EXPECT_EQ(map.size(), 0u);
+}
@@ -0,0 +1,233 @@
+#include "../include/indexed_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct Record {
+  std::string email;
+  std::string region;
+  int age = 0;
+
+  bool operator==(const Record&) const = default;
+};
+
+class IndexedMapTest : public ::testing::Test {
+ protected:
+  // Índices: 0 = email, 1 = região
+  IndexedMap<int, Record, std::string, std::string> users{
+      [](const Record& r) { return r.email; },
+      [](const Record& r) { return r.region; }};
+
+  static std::vector<int> keys(
+      const std::vector<std::pair<int, Record>>& pairs) {
+    std::vector<int> result;
+    for (const auto& [key, value] : pairs) result.push_back(key);
+    return result;
+  }
+};
+
+TEST_F(IndexedMapTest, IsEmptyInitially) {
+  EXPECT_EQ(users.size(), 0u);
+  EXPECT_TRUE(users.find_by<0>("a@x").empty());
+  EXPECT_EQ(users.count_by<1>("eu"), 0u);
+}
+
+TEST_F(IndexedMapTest, FindBySecondaryAttribute) {
+  users[1] = Record{"a@x", "eu", 30};
+  users[2] = Record{"b@x", "us", 40};
+  users[3] = Record{"c@x", "eu", 50};
+
+  auto by_email = users.find_by<0>("b@x");
+  ASSERT_EQ(by_email.size(), 1u);
+  EXPECT_EQ(by_email[0].first, 2);
+  EXPECT_EQ(by_email[0].second.age, 40);
+
+  EXPECT_EQ(keys(users.find_by<1>("eu")), (std::vector<int>{1, 3}));
+  EXPECT_EQ(users.count_by<1>("eu"), 2u);
+  EXPECT_EQ(users.count_by<1>("us"), 1u);
+  EXPECT_EQ(users.count_by<1>("br"), 0u);
+}
+
+TEST_F(IndexedMapTest, AssignmentReindexes) {
+  users[1] = Record{"a@x", "eu", 30};
+  users[1] = Record{"a@y", "us", 31};
+
+  EXPECT_TRUE(users.find_by<0>("a@x").empty());
+  EXPECT_EQ(keys(users.find_by<0>("a@y")), (std::vector<int>{1}));
+  EXPECT_EQ(users.count_by<1>("eu"), 0u);
+  EXPECT_EQ(users.count_by<1>("us"), 1u);
+  EXPECT_EQ(users.size(), 1u);
+}
+
+TEST_F(IndexedMapTest, AccessInsertsDefaultValue) {
+  const Record& record = users[7];
+  EXPECT_EQ(record, Record{});
+  EXPECT_EQ(users.count_by<0>(""), 1u);
+
+  users[8] = users[7];
+  EXPECT_EQ(users.count_by<0>(""), 2u);
+}
+
+TEST_F(IndexedMapTest, RemoveDropsIndexEntries) {
+  users[1] = Record{"a@x", "eu", 30};
+  users[2] = Record{"b@x", "eu", 40};
+  EXPECT_TRUE(users.remove(1));
+  EXPECT_FALSE(users.remove(1));
+  EXPECT_FALSE(users.contain(1));
+  EXPECT_TRUE(users.find_by<0>("a@x").empty());
+  EXPECT_EQ(keys(users.find_by<1>("eu")), (std::vector<int>{2}));
+}
+
+TEST_F(IndexedMapTest, ConstAccessThrowsOnMissingKey) {
+  users[1] = Record{"a@x", "eu", 30};
+  const auto& view = users;
+  EXPECT_EQ(view[1].email, "a@x");
+  EXPECT_THROW(view[2], std::out_of_range);
+}
+
+TEST_F(IndexedMapTest, ManyRecordsPerAttribute) {
+  IndexedMap<int, int, int> parity{[](const int& v) { return v % 2; }};
+  for (int i = 0; i < 1000; ++i) {
+    parity[i] = i;
+  }
+  for (int i = 0; i < 1000; i += 4) {
+    parity[i] = 1;  // Passa de par para ímpar
+  }
+  EXPECT_EQ(parity.count_by<0>(0), 250u);
+  EXPECT_EQ(parity.count_by<0>(1), 750u);
+  auto even = parity.find_by<0>(0);
+  ASSERT_EQ(even.size(), 250u);
+  EXPECT_EQ(even.front().first, 2);
+  EXPECT_EQ(even.back().first, 998);
+}
+
+TEST_F(IndexedMapTest, CopyRebuildsIndexesOverOwnNodes) {
+  users[1] = Record{"a@x", "eu", 30};
+  users[2] = Record{"b@x", "us", 40};
+
+  auto copy = std::make_unique<decltype(users)>(users);
+  users[1] = Record{"a@y", "us", 31};
+  users.remove(2);
+
+  EXPECT_EQ(keys(copy->find_by<1>("eu")), (std::vector<int>{1}));
+  EXPECT_EQ(copy->find_by<0>("b@x")[0].second.age, 40);
+  EXPECT_EQ(keys(users.find_by<1>("us")), (std::vector<int>{1}));
+
+  // O mapa movido continua apontando para os mesmos nós
+  decltype(users) moved = std::move(*copy);
+  copy.reset();
+  EXPECT_EQ(keys(moved.find_by<1>("us")), (std::vector<int>{2}));
+  moved[2] = Record{"b@x", "eu", 41};
+  EXPECT_EQ(keys(moved.find_by<1>("eu")), (std::vector<int>{1, 2}));
+
+  users = moved;
+  moved.remove(1);
+  EXPECT_EQ(users.count_by<1>("eu"), 2u);
+  EXPECT_EQ(users.find_by<0>("a@x")[0].first, 1);
+}
+
+TEST(IndexedMapFailureTest, ThrowingExtractorKeepsIndexes) {
+  // O segundo índice recusa idades negativas
+  IndexedMap<int, Record, std::string, int> users{
+      [](const Record& r) { return r.region; },
+      [](const Record& r) {
+        if (r.age < 0) throw std::invalid_argument("negative age");
+        return r.age;
+      }};
+  users[1] = Record{"a@x", "eu", 30};
+
+  EXPECT_THROW(users[1] = (Record{"a@x", "us", -1}), std::invalid_argument);
+  EXPECT_EQ(users[1].get(), (Record{"a@x", "eu", 30}));
+  EXPECT_EQ(users.count_by<0>("eu"), 1u);
+  EXPECT_EQ(users.count_by<0>("us"), 0u);
+  EXPECT_EQ(users.count_by<1>(30), 1u);
+
+  users[1] = Record{"a@x", "us", 31};
+  EXPECT_EQ(users.count_by<0>("eu"), 0u);
+  EXPECT_EQ(users.count_by<1>(31), 1u);
+}
+
+// Valor cuja atribuição lança exceção quando `armed` está ligado
+struct FragileRecord {
+  static inline bool armed = false;
+  std::string region;
+
+  FragileRecord() = default;
+  explicit FragileRecord(std::string r) : region(std::move(r)) {}
+  FragileRecord(const FragileRecord&) = default;
+  FragileRecord& operator=(const FragileRecord& other) {
+    if (armed) throw std::runtime_error("assignment failed");
+    region = other.region;
+    return *this;
+  }
+};
+
+TEST(IndexedMapFailureTest, ThrowingAssignmentKeepsIndexes) {
+  IndexedMap<int, FragileRecord, std::string> users{
+      [](const FragileRecord& r) { return r.region; }};
+  users[1] = FragileRecord("eu");
+
+  FragileRecord::armed = true;
+  EXPECT_THROW(users[1] = FragileRecord("us"), std::runtime_error);
+  FragileRecord::armed = false;
+
+  EXPECT_EQ(users[1].get().region, "eu");
+  EXPECT_EQ(users.count_by<0>("eu"), 1u);
+  EXPECT_EQ(users.count_by<0>("us"), 0u);
+  EXPECT_TRUE(users.remove(1));
+  EXPECT_EQ(users.count_by<0>("eu"), 0u);
+}
+
+TEST(IndexedMapFailureTest, ThrowingExtractorOnInsertLeavesNoKey) {
+  // O segundo índice recusa registros sem região
+  IndexedMap<int, Record, int, std::string> users{
+      [](const Record& r) { return r.age; },
+      [](const Record& r) {
+        if (r.region.empty()) throw std::invalid_argument("no region");
+        return r.region;
+      }};
+
+  EXPECT_THROW(users[2], std::invalid_argument);
+  EXPECT_FALSE(users.contain(2));
+  EXPECT_EQ(users.size(), 0u);
+  EXPECT_EQ(users.count_by<0>(0), 0u);
+}
+
+// Valor que conta as próprias construções
+struct Counted {
+  static inline int constructions = 0;
+  int id = 0;
+
+  Counted() { ++constructions; }
+  Counted(const Counted& other) : id(other.id) { ++constructions; }
+  Counted& operator=(const Counted&) = default;
+};
+
+TEST(IndexedMapProbeTest, LookupsConstructNoValue) {
+  IndexedMap<int, Counted, int> items{
+      [](const Counted& c) { return c.id % 2; }};
+  for (int i = 0; i < 4; ++i) {
+    Counted value;
+    value.id = i;
+    items[i] = value;
+  }
+
+  const auto& view = items;
+  int before = Counted::constructions;
+  EXPECT_TRUE(items.contain(1));
+  EXPECT_FALSE(items.contain(9));
+  EXPECT_EQ(view[2].id, 2);
+  EXPECT_EQ(items[3].get().id, 3);
+  EXPECT_TRUE(items.remove(0));
+  EXPECT_FALSE(items.remove(0));
+  EXPECT_EQ(Counted::constructions, before);
+
+  // Só a cópia de cada resultado constrói valores
+  EXPECT_EQ(items.find_by<0>(1).size(), 2u);
+  EXPECT_EQ(Counted::constructions, before + 2);
+}
@@ -0,0 +1,104 @@
+#include "../include/key_encoding.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../include/map.hpp"
+
+// Verifica que a ordem das codificações é a ordem dos valores
+template <class T>
+void expect_order_preserved(const std::vector<T>& values) {
+  for (const T& a : values) {
+    for (const T& b : values) {
+      ASSERT_EQ(encode_key(a) < encode_key(b), a < b);
+    }
+  }
+}
+
+TEST(KeyEncodingTest, IntegersPreserveOrder) {
+  expect_order_preserved<int>({std::numeric_limits<int>::min(), -1000, -1, 0,
+                               1, 255, 256, std::numeric_limits<int>::max()});
+  expect_order_preserved<std::uint64_t>(
+      {0, 1, 255, 256, std::numeric_limits<std::uint64_t>::max()});
+  expect_order_preserved<std::int8_t>({-128, -1, 0, 1, 127});
+  EXPECT_EQ(encode_key(std::int32_t{1}).size(), 4u);
+}
+
+TEST(KeyEncodingTest, FloatsPreserveOrder) {
+  const double inf = std::numeric_limits<double>::infinity();
+  expect_order_preserved<double>({-inf, -1e300, -2.5, -1e-300, 0.0, 1e-300,
+                                  0.5, 2.5, 1e300, inf});
+  expect_order_preserved<float>({-3.0f, -0.25f, 0.0f, 0.25f, 3.0f});
+  EXPECT_EQ(encode_key(-0.0), encode_key(0.0));
+}
+
+TEST(KeyEncodingTest, StringsPreserveOrder) {
+  using namespace std::string_literals;
+  expect_order_preserved<std::string>(
+      {""s, "\0"s, "\0\0"s, "\0a"s, "a"s, "a\0"s, "a\0b"s, "ab"s, "b"s,
+       "\xff"s, "\xff\xff"s});
+}
+
+TEST(KeyEncodingTest, TuplesPreserveLexicographicOrder) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> number(-3, 3);
+  std::uniform_int_distribution<int> letters(0, 2);
+
+  std::vector<std::tuple<int, std::string, double>> keys;
+  for (int i = 0; i < 200; ++i) {
+    std::string text(letters(gen), 'a' + letters(gen));
+    keys.emplace_back(number(gen), text, number(gen) / 2.0);
+  }
+  expect_order_preserved(keys);
+
+  // Uma string é seguida de outra parte sem ambiguidade
+  EXPECT_LT(encode_key(std::string("a"), 9), encode_key(std::string("ab"), 0));
+  EXPECT_EQ(encode_key("abc", 1), encode_key(std::string("abc"), 1));
+}
+
+TEST(KeyEncodingTest, DecodeRoundTrip) {
+  using Key = std::tuple<bool, std::int16_t, std::uint32_t, float, double,
+                         std::string>;
+  Key key{true, -7, 4000000000u, -1.5f, 3.25, std::string("x\0y", 3)};
+  std::string bytes = std::apply(
+      [](const auto&... parts) { return encode_key(parts...); }, key);
+  EXPECT_EQ(decode_key<Key>(bytes), key);
+
+  auto pair = std::make_pair(std::string("k"), -42L);
+  EXPECT_EQ((decode_key<std::pair<std::string, long>>(encode_key(pair))),
+            pair);
+  EXPECT_EQ(decode_key<int>(encode_key(-5)), -5);
+}
+
+TEST(KeyEncodingTest, DecodeRejectsMalformedInput) {
+  EXPECT_THROW(decode_key<int>("abc"), std::invalid_argument);
+  EXPECT_THROW(decode_key<int>(encode_key(1) + "x"), std::invalid_argument);
+  EXPECT_THROW(decode_key<std::string>("abc"), std::invalid_argument);
+  EXPECT_THROW(decode_key<std::string>(std::string("a\0b", 3)),
+               std::invalid_argument);
+}
+
+TEST(KeyEncodingTest, MapWithEncodedCompositeKeys) {
+  Map<std::string, int> map;
+  map[encode_key(std::string("eu"), 2)] = 1;
+  map[encode_key(std::string("us"), -1)] = 2;
+  map[encode_key(std::string("eu"), -10)] = 3;
+  map[encode_key(std::string("e"), 100)] = 4;
+
+  std::vector<std::pair<std::string, int>> decoded;
+  for (const auto& [bytes, value] : map.bottom_k(map.size())) {
+    auto [region, id] = decode_key<std::tuple<std::string, int>>(bytes);
+    decoded.emplace_back(region + ":" + std::to_string(id), value);
+  }
+  std::vector<std::pair<std::string, int>> expected = {
+      {"e:100", 4}, {"eu:-10", 3}, {"eu:2", 1}, {"us:-1", 2}};
+  EXPECT_EQ(decoded, expected);
+}
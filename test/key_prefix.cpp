@@ -0,0 +1,110 @@
+#include "../include/key_prefix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../include/map.hpp"
+
+using Prefix = KeyPrefix<std::string>;
+
+TEST(KeyPrefixTest, NonTextKeysHaveNoPrefix) {
+  static_assert(sizeof(KeyPrefix<int>) == 1);
+  EXPECT_TRUE(KeyPrefix<int>(1) == KeyPrefix<int>(2));
+  EXPECT_FALSE(KeyPrefix<int>(1) < KeyPrefix<int>(2));
+}
+
+TEST(KeyPrefixTest, EncodesFirstBytesBigEndian) {
+  EXPECT_EQ(Prefix("").value, 0u);
+  EXPECT_EQ(Prefix("A").value, 0x4100000000000000u);
+  EXPECT_EQ(Prefix("ABCDEFGHIJ").value, Prefix("ABCDEFGH").value);
+  EXPECT_TRUE(Prefix("ab") < Prefix("b"));
+  EXPECT_TRUE(Prefix("ab") == Prefix(std::string_view("ab\0", 3)));
+}
+
+TEST(KeyPrefixTest, OrderAgreesWithStringOrder) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> length(0, 12);
+  // Poucos símbolos, incluindo bytes acima de 127, para gerar prefixos
+  // comuns
+  const std::string alphabet = "ab\xe9\xff";
+  std::uniform_int_distribution<std::size_t> symbol(0, alphabet.size() - 1);
+
+  std::vector<std::string> keys(500);
+  for (std::string& key : keys) {
+    int n = length(gen);
+    for (int i = 0; i < n; ++i) key += alphabet[symbol(gen)];
+  }
+  for (const std::string& a : keys) {
+    for (const std::string& b : keys) {
+      Prefix pa(a), pb(b);
+      if (pa < pb) {
+        ASSERT_LT(a, b);
+      }
+      if (!(pa == pb)) {
+        ASSERT_EQ(pa < pb, a < b);
+      }
+    }
+  }
+}
+
+struct Name {
+  std::string text;
+};
+bool operator<(const Name& n, const std::string& s) { return n.text < s; }
+bool operator<(const std::string& s, const Name& n) { return s < n.text; }
+
+TEST(KeyPrefixTest, MapWithSharedPrefixKeys) {
+  Map<std::string, int> map;
+  for (int i = 0; i < 200; ++i) {
+    map["common/prefix/" + std::to_string(i)] = i;
+    map[std::to_string(i)] = -i;
+  }
+  EXPECT_EQ(map.size(), 400u);
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_EQ(map[std::string_view("common/prefix/" + std::to_string(i))], i);
+    EXPECT_EQ(map[std::to_string(i)], -i);
+  }
+  // Chave heterogênea da qual não se obtém um prefixo
+  const auto& const_map = map;
+  EXPECT_EQ(const_map[Name{"common/prefix/7"}], 7);
+  EXPECT_TRUE(map.remove(Name{"7"}));
+  EXPECT_EQ(map.size(), 399u);
+}
+
+// Texto comparado sem distinção de maiúsculas: conversível em
+// `std::string_view`, mas com uma ordem diferente da dos bytes
+struct CaselessKey {
+  std::string text;
+
+  operator std::string_view() const { return text; }
+
+  bool operator<(const CaselessKey& other) const {
+    return std::ranges::lexicographical_compare(
+        text, other.text, [](unsigned char a, unsigned char b) {
+          return std::tolower(a) < std::tolower(b);
+        });
+  }
+};
+
+TEST(KeyPrefixTest, CustomOrderedTextKeysKeepTheirOrder) {
+  static_assert(sizeof(KeyPrefix<CaselessKey>) == 1);
+  static_assert(sizeof(KeyPrefix<const char*>) == 1);
+
+  Map<CaselessKey, int> map;
+  map[CaselessKey{"abc"}] = 1;
+  map[CaselessKey{"ABC"}] = 2;
+  map[CaselessKey{"Abd"}] = 3;
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map[CaselessKey{"aBc"}], 2);
+
+  std::vector<std::pair<CaselessKey, int>> pairs = map.top_k(2);
+  ASSERT_EQ(pairs.size(), 2u);
+  EXPECT_EQ(pairs[0].first.text, "Abd");
+  EXPECT_EQ(pairs[1].first.text, "abc");
+}
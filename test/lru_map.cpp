@@ -0,0 +1,193 @@
+#include "../include/lru_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+class LruMapTest : public ::testing::Test {
+ protected:
+  LruMap<int, std::string> cache{3};
+
+  static std::vector<int> keys(const LruMap<int, std::string>& lru) {
+    std::vector<int> result;
+    for (const auto& [key, value] : lru.recency_order()) {
+      result.push_back(key);
+    }
+    return result;
+  }
+};
+
+TEST_F(LruMapTest, IsEmptyInitially) {
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.weight(), 0u);
+  EXPECT_EQ(cache.limit(), 3u);
+  EXPECT_EQ(cache.get(1), nullptr);
+}
+
+TEST_F(LruMapTest, EvictsLeastRecentlyUsed) {
+  EXPECT_EQ(cache.put(1, "a"), 0u);
+  EXPECT_EQ(cache.put(2, "b"), 0u);
+  EXPECT_EQ(cache.put(3, "c"), 0u);
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "a");
+
+  EXPECT_EQ(cache.put(4, "d"), 1u);
+  EXPECT_EQ(cache.peek(2), nullptr);
+  EXPECT_EQ(keys(cache), (std::vector<int>{4, 1, 3}));
+  EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST_F(LruMapTest, PeekDoesNotTouchRecency) {
+  cache.put(1, "a");
+  cache.put(2, "b");
+  EXPECT_EQ(*cache.peek(1), "a");
+  EXPECT_EQ(keys(cache), (std::vector<int>{2, 1}));
+}
+
+TEST_F(LruMapTest, PutUpdatesExistingEntry) {
+  cache.put(1, "a");
+  cache.put(2, "b");
+  EXPECT_EQ(cache.put(1, "z"), 0u);
+  EXPECT_EQ(*cache.peek(1), "z");
+  EXPECT_EQ(keys(cache), (std::vector<int>{1, 2}));
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(LruMapTest, RemoveAndRemoveRange) {
+  for (int i = 0; i < 3; ++i) cache.put(i, "x");
+  EXPECT_TRUE(cache.remove(1));
+  EXPECT_FALSE(cache.remove(1));
+  EXPECT_EQ(keys(cache), (std::vector<int>{2, 0}));
+
+  LruMap<int, int> big(100);
+  for (int i = 0; i < 50; ++i) big.put(i, i);
+  EXPECT_EQ(big.remove_range(10, 20), 10u);
+  EXPECT_EQ(big.remove_range(20, 10), 0u);
+  EXPECT_EQ(big.size(), 40u);
+  EXPECT_EQ(big.peek(15), nullptr);
+  EXPECT_NE(big.peek(20), nullptr);
+  EXPECT_EQ(big.recency_order().front().first, 49);
+  EXPECT_EQ(big.recency_order().back().first, 0);
+}
+
+TEST_F(LruMapTest, MemoryBudget) {
+  LruMap<int, std::string> sized(
+      10, [](const int&, const std::string& v) { return v.size(); });
+  sized.put(1, "aaaa");
+  sized.put(2, "bbbb");
+  EXPECT_EQ(sized.weight(), 8u);
+  EXPECT_EQ(sized.put(3, "cccc"), 1u);
+  EXPECT_EQ(sized.peek(1), nullptr);
+  EXPECT_EQ(sized.weight(), 8u);
+
+  // Uma entrada maior que o limite não fica no cache
+  EXPECT_EQ(sized.put(4, std::string(11, 'd')), 3u);
+  EXPECT_EQ(sized.size(), 0u);
+  EXPECT_EQ(sized.weight(), 0u);
+}
+
+TEST_F(LruMapTest, CopyAndMove) {
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.get(1);
+
+  LruMap<int, std::string> copy(cache);
+  copy.put(3, "c");
+  copy.put(4, "d");
+  EXPECT_EQ(keys(copy), (std::vector<int>{4, 3, 1}));
+  EXPECT_EQ(keys(cache), (std::vector<int>{1, 2}));
+
+  LruMap<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(keys(moved), (std::vector<int>{4, 3, 1}));
+  cache = moved;
+  cache.get(3);
+  EXPECT_EQ(keys(cache), (std::vector<int>{3, 4, 1}));
+  EXPECT_EQ(keys(moved), (std::vector<int>{4, 3, 1}));
+}
+
+TEST_F(LruMapTest, ManyOperationsKeepListConsistent) {
+  LruMap<int, int> lru(64);
+  for (int i = 0; i < 5000; ++i) {
+    lru.put((i * 37) % 200, i);
+    lru.get((i * 11) % 200);
+    if (i % 7 == 0) lru.remove((i * 13) % 200);
+  }
+  auto order = lru.recency_order();
+  EXPECT_EQ(order.size(), lru.size());
+  EXPECT_LE(lru.size(), 64u);
+  for (const auto& [key, value] : order) {
+    ASSERT_NE(lru.peek(key), nullptr);
+    EXPECT_EQ(*lru.peek(key), value);
+  }
+}
+
+// Valor sem construtor padrão que conta as próprias construções
+struct Blob {
+  static inline int constructions = 0;
+  std::size_t bytes;
+
+  explicit Blob(std::size_t b) : bytes(b) { ++constructions; }
+  Blob(const Blob& other) : bytes(other.bytes) { ++constructions; }
+  Blob& operator=(const Blob&) = default;
+};
+
+TEST(LruMapProbeTest, LookupsConstructNoValue) {
+  LruMap<int, Blob> blobs(4);
+  for (int i = 0; i < 4; ++i) blobs.put(i, Blob(i));
+
+  int before = Blob::constructions;
+  ASSERT_NE(blobs.get(1), nullptr);
+  EXPECT_EQ(blobs.peek(2)->bytes, 2u);
+  EXPECT_EQ(blobs.peek(9), nullptr);
+  EXPECT_TRUE(blobs.remove(0));
+  EXPECT_EQ(blobs.remove_range(2, 4), 2u);
+  EXPECT_EQ(Blob::constructions, before);
+  EXPECT_EQ(blobs.size(), 1u);
+
+  // Descartar por limite também usa a busca por chave
+  blobs.put(5, Blob(5));
+  EXPECT_EQ(blobs.put(6, Blob(6)) + blobs.put(7, Blob(7)) +
+                blobs.put(8, Blob(8)),
+            1u);
+  EXPECT_EQ(blobs.size(), 4u);
+}
+
+struct Touchy {
+  static inline bool fail = false;
+  int id;
+
+  explicit Touchy(int i) : id(i) {}
+  Touchy(const Touchy&) = default;
+  Touchy& operator=(const Touchy& other) {
+    if (fail) throw std::runtime_error("assignment failed");
+    id = other.id;
+    return *this;
+  }
+};
+
+TEST(LruMapFailureTest, ThrowingAssignmentKeepsEntryInRecencyList) {
+  using Cache = LruMap<int, Touchy>;
+  Cache cache(3);
+  for (int i = 1; i <= 3; ++i) cache.put(i, Touchy(i));
+
+  Touchy::fail = true;
+  EXPECT_THROW(cache.put(2, Touchy(20)), std::runtime_error);
+  Touchy::fail = false;
+
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.weight(), 3u);
+  EXPECT_EQ(cache.recency_order().size(), 3u);
+  EXPECT_EQ(cache.peek(2)->id, 2);
+
+  // A entrada continua descartável pela ordem de uso
+  EXPECT_TRUE(cache.remove(1));
+  EXPECT_TRUE(cache.remove(3));
+  EXPECT_EQ(cache.put(4, Touchy(4)) + cache.put(5, Touchy(5)) +
+                cache.put(6, Touchy(6)),
+            1u);
+  EXPECT_EQ(cache.peek(2), nullptr);
+  EXPECT_EQ(cache.recency_order().size(), cache.size());
+}
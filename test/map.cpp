@@ -2,8 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 
 struct MyValue {
@@ -23,6 +29,20 @@ struct MyValue {
 };
 
 
+// Chave que conta quantas vezes foi construída e é comparável com `int`
+struct CountedKey {
+  static inline int constructions = 0;
+  int id;
+
+  explicit CountedKey(int i) : id(i) { ++constructions; }
+  CountedKey(const CountedKey& other) : id(other.id) { ++constructions; }
+
+  bool operator<(const CountedKey& other) const { return id < other.id; }
+  friend bool operator<(const CountedKey& k, int i) { return k.id < i; }
+  friend bool operator<(int i, const CountedKey& k) { return i < k.id; }
+};
+
+
 class MapTest : public ::testing::Test {
  protected:
   Map<int, int> intIntMap;
@@ -217,3 +237,255 @@ TEST_F(MapTest, ScopeAndDestruction) {
   }
   SUCCEED();
 }
+
+TEST_F(MapTest, SizeAndParallelInOrder) {
+  EXPECT_EQ(intStringMap.size(), 0u);
+  intStringMap[3] = "c";
+  intStringMap[1] = "a";
+  intStringMap[2] = "b";
+  EXPECT_EQ(intStringMap.size(), 3u);
+
+  std::vector<std::pair<int, std::string>> out(intStringMap.size());
+  intStringMap.parallel_in_order(std::span<std::pair<int, std::string>>(out));
+  std::vector<std::pair<int, std::string>> expected = {
+      {1, "a"}, {2, "b"}, {3, "c"}};
+  EXPECT_EQ(out, expected);
+}
+
+TEST_F(MapTest, ParallelAlgorithmsAndFilter) {
+  for (int k = 1; k <= 10; ++k) {
+    intIntMap[k] = k * 10;
+  }
+
+  int total = intIntMap.parallel_reduce(
+      0, [](int, int v) { return v; }, [](int a, int b) { return a + b; });
+  EXPECT_EQ(total, 550);
+
+  std::atomic<int> keys{0};
+  intIntMap.parallel_for_each([&](int k, int) { keys += k; });
+  EXPECT_EQ(keys.load(), 55);
+
+  Map<int, int> big = intIntMap.filter([](int, int v) { return v > 50; });
+  EXPECT_EQ(big.size(), 5u);
+  EXPECT_EQ(big[6], 60);
+  const auto& const_big = big;
+  ASSERT_THROW(const_big[5], std::out_of_range);
+}
+
+TEST_F(MapTest, InsertAndRemoveBatch) {
+  intStringMap[2] = "existing";
+  std::vector<std::pair<int, std::string>> batch = {
+      {3, "c"}, {1, "a"}, {2, "b"}, {3, "ignored"}};
+  EXPECT_EQ(intStringMap.insert_batch(batch), 2u);
+  EXPECT_EQ(intStringMap.size(), 3u);
+  EXPECT_EQ(intStringMap[1], "a");
+  EXPECT_EQ(intStringMap[2], "existing");
+  EXPECT_EQ(intStringMap[3], "c");
+
+  EXPECT_EQ(intStringMap.remove_batch(std::vector<int>{1, 3, 7}), 2u);
+  EXPECT_EQ(intStringMap.size(), 1u);
+  const auto& const_map = intStringMap;
+  ASSERT_THROW(const_map[1], std::out_of_range);
+}
+
+TEST_F(MapTest, TransactionCommitAppliesAllChanges) {
+  intIntMap[1] = 10;
+  intIntMap[2] = 20;
+  intIntMap[3] = 30;
+
+  {
+    auto tx = intIntMap.transaction();
+    tx[1] = 11;        // Sobrescreve
+    tx[4] += 40;       // Nova chave, valor padrão + 40
+    EXPECT_TRUE(tx.remove(2));
+    EXPECT_FALSE(tx.remove(2));  // Já removida na transação
+    EXPECT_FALSE(tx.remove(99));
+    EXPECT_EQ(tx[3], 30);        // Lê o valor atual
+
+    // Nada é visível antes do commit
+    EXPECT_EQ(intIntMap[1], 10);
+    EXPECT_EQ(intIntMap.size(), 3u);
+
+    tx.commit();
+  }
+
+  EXPECT_EQ(intIntMap.size(), 3u);
+  EXPECT_EQ(intIntMap[1], 11);
+  EXPECT_EQ(intIntMap[3], 30);
+  EXPECT_EQ(intIntMap[4], 40);
+  const auto& const_map = intIntMap;
+  ASSERT_THROW(const_map[2], std::out_of_range);
+}
+
+TEST_F(MapTest, TransactionRemoveThenWrite) {
+  intStringMap[1] = "old";
+  auto tx = intStringMap.transaction();
+  EXPECT_TRUE(tx.remove(1));
+  EXPECT_EQ(tx[1], "");  // Recriada com o valor padrão
+  tx[1] = "new";
+  tx.commit();
+  EXPECT_EQ(intStringMap[1], "new");
+  EXPECT_EQ(intStringMap.size(), 1u);
+}
+
+TEST_F(MapTest, TransactionRollsBackOnException) {
+  intIntMap[1] = 10;
+  intIntMap[2] = 20;
+
+  auto update = [&] {
+    auto tx = intIntMap.transaction();
+    tx[1] = 100;
+    tx.remove(2);
+    tx[3] = 300;
+    throw std::runtime_error("falha no meio da atualização");
+    tx.commit();
+  };
+  EXPECT_THROW(update(), std::runtime_error);
+
+  EXPECT_EQ(intIntMap.size(), 2u);
+  EXPECT_EQ(intIntMap[1], 10);
+  EXPECT_EQ(intIntMap[2], 20);
+
+  auto tx = intIntMap.transaction();
+  tx[1] = 5;
+  tx.rollback();
+  tx.commit();  // Nada pendente
+  EXPECT_EQ(intIntMap[1], 10);
+}
+
+TEST_F(MapTest, UpsertCombinesExistingValues) {
+  auto add = [](int current, int incoming) { return current + incoming; };
+  EXPECT_TRUE(intIntMap.upsert(1, 5, add));
+  EXPECT_FALSE(intIntMap.upsert(1, 7, add));
+  EXPECT_TRUE(intIntMap.upsert(2, 1, add));
+  EXPECT_EQ(intIntMap[1], 12);
+  EXPECT_EQ(intIntMap[2], 1);
+  EXPECT_EQ(intIntMap.size(), 2u);
+}
+
+TEST_F(MapTest, UpsertBatchFoldsDuplicates) {
+  intStringMap[2] = "b";
+  auto concat = [](const std::string& current, const std::string& incoming) {
+    return current + incoming;
+  };
+  std::vector<std::pair<int, std::string>> batch = {
+      {3, "x"}, {2, "y"}, {3, "z"}, {1, "w"}};
+  EXPECT_EQ(intStringMap.upsert_batch(batch, concat), 2u);
+  EXPECT_EQ(intStringMap[1], "w");
+  EXPECT_EQ(intStringMap[2], "by");
+  EXPECT_EQ(intStringMap[3], "xz");
+}
+
+TEST_F(MapTest, MergeFromOtherMap) {
+  Map<int, int> other;
+  for (int k = 0; k < 10; ++k) {
+    intIntMap[k] = 1;
+    other[k + 5] = 10;
+  }
+  EXPECT_EQ(intIntMap.merge_from(other, [](int a, int b) { return a + b; }),
+            5u);
+  EXPECT_EQ(intIntMap.size(), 15u);
+  EXPECT_EQ(intIntMap[4], 1);
+  EXPECT_EQ(intIntMap[5], 11);
+  EXPECT_EQ(intIntMap[14], 10);
+  EXPECT_EQ(other.size(), 10u);
+}
+
+TEST_F(MapTest, TopKAndBottomK) {
+  intIntMap[1] = 30;
+  intIntMap[2] = 10;
+  intIntMap[3] = 50;
+  intIntMap[4] = 10;
+  intIntMap[5] = 40;
+
+  std::vector<std::pair<int, int>> top_keys = {{5, 40}, {4, 10}};
+  EXPECT_EQ(intIntMap.top_k(2), top_keys);
+  std::vector<std::pair<int, int>> bottom_keys = {{1, 30}, {2, 10}};
+  EXPECT_EQ(intIntMap.bottom_k(2), bottom_keys);
+
+  std::vector<std::pair<int, int>> top_values = {{3, 50}, {5, 40}, {1, 30}};
+  EXPECT_EQ(intIntMap.top_k_by_value(3), top_values);
+  std::vector<std::pair<int, int>> bottom_values = {{2, 10}, {4, 10}};
+  EXPECT_EQ(intIntMap.bottom_k_by_value(2), bottom_values);
+  EXPECT_TRUE(intIntMap.top_k_by_value(0).empty());
+}
+
+TEST_F(MapTest, Sample) {
+  const auto& const_map = intIntMap;
+  EXPECT_THROW(const_map.sample(), std::out_of_range);
+  for (int k = 1; k <= 5; ++k) {
+    intIntMap[k] = k * 100;
+  }
+  auto [key, value] = intIntMap.sample();
+  EXPECT_EQ(value, key * 100);
+
+  std::mt19937 gen(3);
+  auto picked = intIntMap.sample(3, gen);
+  EXPECT_EQ(picked.size(), 3u);
+  for (const auto& [k, v] : picked) {
+    EXPECT_EQ(v, k * 100);
+  }
+}
+
+TEST_F(MapTest, HeterogeneousLookup) {
+  stringMyValueMap["alpha"] = MyValue(1, "a");
+  std::string_view key = "alpha";
+  EXPECT_EQ(stringMyValueMap[key].id, 1);
+  stringMyValueMap[std::string_view("beta")] = MyValue(2, "b");
+  EXPECT_EQ(stringMyValueMap.size(), 2u);
+
+  const auto& const_map = stringMyValueMap;
+  EXPECT_EQ(const_map[std::string_view("beta")].id, 2);
+  EXPECT_THROW(const_map[std::string_view("gamma")], std::out_of_range);
+
+  EXPECT_TRUE(stringMyValueMap.remove(std::string_view("alpha")));
+  EXPECT_FALSE(stringMyValueMap.remove("alpha"));
+  EXPECT_EQ(stringMyValueMap.size(), 1u);
+}
+
+TEST_F(MapTest, HeterogeneousLookupConstructsNoKey) {
+  Map<CountedKey, int> counted;
+  counted[CountedKey(1)] = 10;
+  counted[CountedKey(2)] = 20;
+
+  int before = CountedKey::constructions;
+  EXPECT_EQ(counted[1], 10);
+  const auto& const_map = counted;
+  EXPECT_EQ(const_map[2], 20);
+  EXPECT_TRUE(counted.remove(1));
+  EXPECT_FALSE(counted.remove(1));
+  EXPECT_EQ(CountedKey::constructions, before);
+
+  // Uma chave nova é construída uma única vez para ser inserida
+  counted[3] = 30;
+  EXPECT_GT(CountedKey::constructions, before);
+  EXPECT_EQ(const_map[3], 30);
+}
+
+TEST_F(MapTest, SubscriptHitCopiesNoKey) {
+  Map<CountedKey, int> counted;
+  const CountedKey one(1);
+  counted[one] = 10;
+
+  int before = CountedKey::constructions;
+  counted[one] += 5;
+  EXPECT_EQ(counted[one], 15);
+  EXPECT_EQ(CountedKey::constructions, before);
+}
+
+TEST_F(MapTest, RemoveLazy) {
+  stringMyValueMap["alpha"] = MyValue(1, "a");
+  stringMyValueMap["beta"] = MyValue(2, "b");
+  EXPECT_TRUE(stringMyValueMap.remove_lazy("alpha"));
+  EXPECT_FALSE(stringMyValueMap.remove_lazy("alpha"));
+  EXPECT_EQ(stringMyValueMap.size(), 1u);
+
+  const auto& const_map = stringMyValueMap;
+  EXPECT_THROW(const_map["alpha"], std::out_of_range);
+
+  // A chave volta com o valor padrão, não com o valor marcado
+  EXPECT_EQ(stringMyValueMap["alpha"], MyValue());
+  EXPECT_EQ(stringMyValueMap.size(), 2u);
+  stringMyValueMap.purge();
+  EXPECT_EQ(const_map["beta"].id, 2);
+}
@@ -0,0 +1,207 @@
+#include "../include/multimap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+class MultiMapTest : public ::testing::Test {
+ protected:
+  MultiMap<int, std::string> index;
+
+  static std::vector<std::string> values(std::span<const std::string> view) {
+    return {view.begin(), view.end()};
+  }
+};
+
+TEST_F(MultiMapTest, IsEmptyInitially) {
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_EQ(index.distinct(), 0u);
+  EXPECT_TRUE(index.find(1).empty());
+  EXPECT_EQ(index.count(1), 0u);
+}
+
+TEST_F(MultiMapTest, InsertKeepsArrivalOrder) {
+  index.insert(1, "a");
+  index.insert(2, "x");
+  index.insert(1, "b");
+  index.insert(1, "c");
+  index.insert(1, "a");
+
+  EXPECT_EQ(values(index.find(1)),
+            (std::vector<std::string>{"a", "b", "c", "a"}));
+  EXPECT_EQ(values(index.find(2)), (std::vector<std::string>{"x"}));
+  EXPECT_EQ(index.count(1), 4u);
+  EXPECT_EQ(index.size(), 5u);
+  EXPECT_EQ(index.distinct(), 2u);
+}
+
+TEST_F(MultiMapTest, RemoveKey) {
+  index.insert(1, "a");
+  index.insert(1, "b");
+  index.insert(2, "c");
+  EXPECT_EQ(index.remove(1), 2u);
+  EXPECT_EQ(index.remove(1), 0u);
+  EXPECT_TRUE(index.find(1).empty());
+  EXPECT_EQ(index.size(), 1u);
+  EXPECT_EQ(index.distinct(), 1u);
+}
+
+TEST_F(MultiMapTest, RemoveSingleValue) {
+  index.insert(1, "a");
+  index.insert(1, "b");
+  index.insert(1, "a");
+
+  EXPECT_TRUE(index.remove(1, "a"));
+  EXPECT_EQ(values(index.find(1)), (std::vector<std::string>{"b", "a"}));
+  EXPECT_FALSE(index.remove(1, "z"));
+  EXPECT_FALSE(index.remove(2, "a"));
+
+  EXPECT_TRUE(index.remove(1, "b"));
+  EXPECT_TRUE(index.remove(1, "a"));
+  EXPECT_EQ(index.distinct(), 0u);
+  EXPECT_EQ(index.size(), 0u);
+}
+
+TEST_F(MultiMapTest, ManyValuesPerKey) {
+  MultiMap<int, int> groups;
+  for (int i = 0; i < 1000; ++i) {
+    groups.insert(i % 3, i);
+  }
+  // Remoções causam rotações que movem os valores entre nós
+  for (int k = 3; k < 100; ++k) {
+    groups.insert(k, k);
+  }
+  for (int k = 3; k < 100; k += 2) {
+    groups.remove(k);
+  }
+  EXPECT_EQ(groups.distinct(), 3u + 48u);
+  auto view = groups.find(1);
+  ASSERT_EQ(view.size(), 333u);
+  for (std::size_t i = 0; i < view.size(); ++i) {
+    EXPECT_EQ(view[i], static_cast<int>(3 * i + 1));
+  }
+}
+
+// Chave que conta as próprias cópias
+struct CopiedKey {
+  static inline int copies = 0;
+  int id;
+
+  explicit CopiedKey(int i) : id(i) {}
+  CopiedKey(const CopiedKey& other) : id(other.id) { ++copies; }
+  CopiedKey& operator=(const CopiedKey&) = default;
+
+  bool operator<(const CopiedKey& other) const { return id < other.id; }
+};
+
+TEST(MultiMapProbeTest, LookupsCopyNoKey) {
+  MultiMap<CopiedKey, int> groups;
+  const CopiedKey even(0), odd(1);
+  groups.insert(even, 0);
+  groups.insert(odd, 1);
+
+  int before = CopiedKey::copies;
+  groups.insert(even, 2);
+  EXPECT_EQ(groups.find(even).size(), 2u);
+  EXPECT_EQ(groups.count(odd), 1u);
+  EXPECT_EQ(groups.count(CopiedKey(7)), 0u);
+  EXPECT_TRUE(groups.remove(even, 0));
+  EXPECT_EQ(groups.remove(odd), 1u);
+  EXPECT_EQ(CopiedKey::copies, before);
+}
+
+TEST(SmallVectorTest, StaysInlineUpToCapacity) {
+  SmallVector<int, 3> vector;
+  vector.push_back(1);
+  vector.push_back(2);
+  vector.push_back(3);
+  EXPECT_TRUE(vector.is_inline());
+  vector.push_back(4);
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.size(), 4u);
+  EXPECT_GE(vector.capacity(), 4u);
+  EXPECT_EQ(std::vector<int>(vector.begin(), vector.end()),
+            (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(SmallVectorTest, PushBackOwnElementWhileGrowing) {
+  SmallVector<std::string, 1> vector;
+  vector.push_back("abc");
+  vector.push_back(vector[0]);
+  EXPECT_EQ(vector[1], "abc");
+}
+
+TEST(SmallVectorTest, EraseShiftsElements) {
+  SmallVector<std::string> vector;
+  vector.push_back("a");
+  vector.push_back("b");
+  vector.push_back("c");
+  vector.erase(0);
+  EXPECT_EQ(vector.size(), 2u);
+  EXPECT_EQ(vector[0], "b");
+  EXPECT_EQ(vector[1], "c");
+  EXPECT_THROW(vector.erase(2), std::out_of_range);
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+  SmallVector<std::unique_ptr<int>> owners;
+  owners.emplace_back(std::make_unique<int>(1));
+  SmallVector<std::unique_ptr<int>> moved(std::move(owners));
+  EXPECT_EQ(*moved[0], 1);
+  EXPECT_TRUE(owners.empty());
+
+  SmallVector<std::string, 1> inline_copy;
+  inline_copy.push_back("x");
+  SmallVector<std::string, 1> heap_copy;
+  heap_copy.push_back("y");
+  heap_copy.push_back("z");
+
+  SmallVector<std::string, 1> copy(heap_copy);
+  EXPECT_EQ(copy[1], "z");
+  copy = inline_copy;
+  EXPECT_EQ(copy.size(), 1u);
+  EXPECT_TRUE(copy.is_inline());
+
+  SmallVector<std::string, 1> target;
+  target = std::move(heap_copy);
+  EXPECT_EQ(target[0], "y");
+  EXPECT_EQ(target[1], "z");
+  EXPECT_TRUE(heap_copy.empty());
+}
+
+// Elemento que conta as instâncias vivas e cuja cópia pode falhar
+struct Tracked {
+  static inline int alive = 0;
+  static inline int copies_left = -1;  // Negativo: sem limite
+  std::string text;
+
+  explicit Tracked(std::string t) : text(std::move(t)) { ++alive; }
+  Tracked(const Tracked& other) : text(other.text) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+    ++alive;
+  }
+  Tracked(Tracked&& other) noexcept : text(std::move(other.text)) {
+    ++alive;
+  }
+  ~Tracked() { --alive; }
+};
+
+TEST(SmallVectorTest, FailedCopyReleasesPartialElements) {
+  {
+    SmallVector<Tracked, 1> source;
+    for (int i = 0; i < 5; ++i) source.emplace_back(std::to_string(i));
+    EXPECT_EQ(Tracked::alive, 5);
+
+    Tracked::copies_left = 3;
+    using Vector = SmallVector<Tracked, 1>;
+    EXPECT_THROW(Vector copy(source), std::runtime_error);
+    Tracked::copies_left = -1;
+    EXPECT_EQ(Tracked::alive, 5);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
@@ -0,0 +1,100 @@
+#include "../include/multiset.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class MultiSetTest : public ::testing::Test {
+ protected:
+  MultiSet<int> numbers;
+  MultiSet<std::string> words;
+};
+
+TEST_F(MultiSetTest, IsEmptyInitially) {
+  EXPECT_EQ(numbers.size(), 0u);
+  EXPECT_EQ(numbers.distinct(), 0u);
+  EXPECT_FALSE(numbers.contain(1));
+  EXPECT_TRUE(numbers.in_order().empty());
+}
+
+TEST_F(MultiSetTest, InsertCountsCopies) {
+  EXPECT_EQ(numbers.insert(5), 1u);
+  EXPECT_EQ(numbers.insert(5), 2u);
+  EXPECT_EQ(numbers.insert(3, 4), 4u);
+  EXPECT_EQ(numbers.insert(3, 0), 4u);
+  EXPECT_EQ(numbers.insert(7, 0), 0u);
+  EXPECT_FALSE(numbers.contain(7));
+
+  EXPECT_EQ(numbers.count(5), 2u);
+  EXPECT_EQ(numbers.count(3), 4u);
+  EXPECT_EQ(numbers.size(), 6u);
+  EXPECT_EQ(numbers.distinct(), 2u);
+}
+
+TEST_F(MultiSetTest, RemoveOneCopy) {
+  words.insert("a", 2);
+  EXPECT_TRUE(words.remove("a"));
+  EXPECT_EQ(words.count("a"), 1u);
+  EXPECT_TRUE(words.contain("a"));
+  EXPECT_TRUE(words.remove("a"));
+  EXPECT_FALSE(words.contain("a"));
+  EXPECT_FALSE(words.remove("a"));
+  EXPECT_EQ(words.size(), 0u);
+  EXPECT_EQ(words.distinct(), 0u);
+}
+
+TEST_F(MultiSetTest, RemoveAll) {
+  numbers.insert(1, 3);
+  numbers.insert(2);
+  EXPECT_EQ(numbers.remove_all(1), 3u);
+  EXPECT_EQ(numbers.remove_all(1), 0u);
+  EXPECT_EQ(numbers.size(), 1u);
+  EXPECT_EQ(numbers.distinct(), 1u);
+}
+
+TEST_F(MultiSetTest, InOrderExpandsCopies) {
+  numbers.insert(3, 2);
+  numbers.insert(1);
+  numbers.insert(2, 3);
+  EXPECT_EQ(numbers.in_order(), (std::vector<int>{1, 2, 2, 2, 3, 3}));
+}
+
+TEST_F(MultiSetTest, ManyDuplicatesUseOneNodePerValue) {
+  for (int i = 0; i < 10000; ++i) {
+    numbers.insert(i % 10);
+  }
+  EXPECT_EQ(numbers.size(), 10000u);
+  EXPECT_EQ(numbers.distinct(), 10u);
+  for (int v = 0; v < 10; ++v) {
+    EXPECT_EQ(numbers.count(v), 1000u);
+  }
+}
+
+// Valor que conta as próprias cópias
+struct CopiedValue {
+  static inline int copies = 0;
+  std::string text;
+
+  explicit CopiedValue(std::string t) : text(std::move(t)) {}
+  CopiedValue(const CopiedValue& other) : text(other.text) { ++copies; }
+  CopiedValue& operator=(const CopiedValue&) = default;
+
+  bool operator<(const CopiedValue& other) const { return text < other.text; }
+};
+
+TEST(MultiSetProbeTest, LookupsCopyNoValue) {
+  MultiSet<CopiedValue> bag;
+  const CopiedValue apple("apple");
+  bag.insert(apple);
+
+  int before = CopiedValue::copies;
+  EXPECT_EQ(bag.insert(apple, 2), 3u);
+  EXPECT_EQ(bag.count(apple), 3u);
+  EXPECT_TRUE(bag.contain(apple));
+  EXPECT_TRUE(bag.remove(apple));
+  EXPECT_EQ(bag.remove_all(apple), 2u);
+  EXPECT_FALSE(bag.contain(apple));
+  EXPECT_EQ(CopiedValue::copies, before);
+}
@@ -0,0 +1,69 @@
+#include "../include/quantile_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+class QuantileSetTest : public ::testing::Test {
+ protected:
+  QuantileSet<int> values;
+};
+
+TEST_F(QuantileSetTest, EmptyThrows) {
+  EXPECT_EQ(values.size(), 0u);
+  EXPECT_THROW(values.median(), std::out_of_range);
+  EXPECT_FALSE(values.remove(1));
+}
+
+TEST_F(QuantileSetTest, QuantilesOfSimpleSequence) {
+  for (int v = 1; v <= 101; ++v) {
+    values.insert(v);
+  }
+  EXPECT_EQ(values.quantile(0.0), 1);
+  EXPECT_EQ(values.quantile(1.0), 101);
+  EXPECT_EQ(values.median(), 51);
+  EXPECT_EQ(values.quantile(0.99), 100);
+  EXPECT_THROW(values.quantile(1.5), std::out_of_range);
+  EXPECT_THROW(values.quantile(-0.1), std::out_of_range);
+}
+
+TEST_F(QuantileSetTest, DuplicatesAreCounted) {
+  for (int v : {5, 1, 5, 5, 3}) {
+    values.insert(v);
+  }
+  EXPECT_EQ(values.size(), 5u);
+  EXPECT_EQ(values.count(5), 3u);
+  EXPECT_EQ(values.count(4), 0u);
+  EXPECT_EQ(values.rank(5), 2u);
+  EXPECT_EQ(values.median(), 5);
+
+  EXPECT_TRUE(values.remove(5));
+  EXPECT_TRUE(values.remove(5));
+  EXPECT_EQ(values.count(5), 1u);
+  EXPECT_FALSE(values.remove(4));
+  EXPECT_EQ(values.median(), 3);
+}
+
+TEST_F(QuantileSetTest, SlidingWindowMedianMatchesSort) {
+  const std::size_t window = 25;
+  std::deque<int> recent;
+  for (int i = 0; i < 500; ++i) {
+    int v = (i * 7919) % 97;  // Muitos valores repetidos
+    values.insert(v);
+    recent.push_back(v);
+    if (recent.size() > window) {
+      EXPECT_TRUE(values.remove(recent.front()));
+      recent.pop_front();
+    }
+
+    std::vector<int> sorted(recent.begin(), recent.end());
+    std::sort(sorted.begin(), sorted.end());
+    ASSERT_EQ(values.size(), sorted.size());
+    EXPECT_EQ(values.median(), sorted[(sorted.size() - 1) / 2]);
+    EXPECT_EQ(values.quantile(0.9),
+              sorted[static_cast<std::size_t>(0.9 * (sorted.size() - 1))]);
+  }
+}
@@ -0,0 +1,103 @@
+#include "../include/scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/avl.hpp"
+
+// Soma recursiva de [begin, end) com bifurcação em cada nível
+long long parallel_sum(Scheduler& scheduler, long long begin, long long end) {
+  if (end - begin <= 64) {
+    long long sum = 0;
+    for (long long i = begin; i < end; ++i) sum += i;
+    return sum;
+  }
+  long long mid = begin + (end - begin) / 2;
+  long long left = 0, right = 0;
+  scheduler.fork_join([&] { left = parallel_sum(scheduler, begin, mid); },
+                      [&] { right = parallel_sum(scheduler, mid, end); });
+  return left + right;
+}
+
+TEST(SchedulerTest, ForkJoinRunsBothSides) {
+  Scheduler scheduler(2);
+  EXPECT_EQ(scheduler.workers(), 2u);
+
+  int left = 0, right = 0;
+  scheduler.fork_join([&] { left = 1; }, [&] { right = 2; });
+  EXPECT_EQ(left, 1);
+  EXPECT_EQ(right, 2);
+}
+
+TEST(SchedulerTest, NestedForkJoin) {
+  Scheduler scheduler(3);
+  EXPECT_EQ(parallel_sum(scheduler, 0, 100000), 100000LL * 99999 / 2);
+}
+
+TEST(SchedulerTest, ZeroWorkersRunsSequentially) {
+  Scheduler scheduler(0);
+  EXPECT_EQ(scheduler.workers(), 0u);
+
+  std::vector<int> order;
+  scheduler.fork_join([&] { order.push_back(1); },
+                      [&] { order.push_back(2); });
+  std::vector<int> expected = {1, 2};
+  EXPECT_EQ(order, expected);
+  EXPECT_EQ(parallel_sum(scheduler, 0, 1000), 1000LL * 999 / 2);
+}
+
+TEST(SchedulerTest, PropagatesExceptions) {
+  Scheduler scheduler(2);
+  std::atomic<bool> right_ran{false};
+  EXPECT_THROW(scheduler.fork_join([] { throw std::runtime_error("left"); },
+                                   [&] { right_ran = true; }),
+               std::runtime_error);
+  EXPECT_TRUE(right_ran.load());
+
+  EXPECT_THROW(scheduler.fork_join([] {},
+                                   [] { throw std::logic_error("right"); }),
+               std::logic_error);
+}
+
+TEST(SchedulerTest, ConcurrentExternalCallers) {
+  Scheduler scheduler(2);
+  std::vector<long long> results(4);
+  std::vector<std::thread> callers;
+  for (int i = 0; i < 4; ++i) {
+    callers.emplace_back(
+        [&, i] { results[i] = parallel_sum(scheduler, 0, 50000); });
+  }
+  for (std::thread& caller : callers) caller.join();
+  for (long long result : results) {
+    EXPECT_EQ(result, 50000LL * 49999 / 2);
+  }
+}
+
+TEST(SchedulerTest, GlobalWorkersAreConfigurable) {
+  Scheduler::set_global_workers(3);
+  EXPECT_EQ(Scheduler::global().workers(), 3u);
+
+  AVL<int> tree;
+  for (int i = 0; i < 20000; ++i) {
+    tree.insert(i);
+  }
+  long long sum = tree.parallel_reduce(
+      0LL, [](int v) { return static_cast<long long>(v); },
+      [](long long a, long long b) { return a + b; });
+  EXPECT_EQ(sum, 20000LL * 19999 / 2);
+
+  std::vector<int> batch;
+  for (int i = 10000; i < 40000; ++i) {
+    batch.push_back(i);
+  }
+  EXPECT_EQ(tree.insert_batch(batch), 20000u);
+  EXPECT_EQ(tree.remove_batch(batch), 30000u);
+  EXPECT_EQ(tree.size(), 10000u);
+  EXPECT_TRUE(tree.is_balanced());
+
+  Scheduler::set_global_workers(Scheduler::default_workers());
+}
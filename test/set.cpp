@@ -2,6 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
 class SetTest : public ::testing::Test {
  protected:
   Set<int> intSet;
@@ -138,3 +146,102 @@ TEST_F(SetTest, ComplexSequenceOfOperations) {
   EXPECT_FALSE(intSet.search(5));
   EXPECT_FALSE(intSet.remove(10));
 }
+
+TEST_F(SetTest, SizeAndParallelInOrder) {
+  EXPECT_EQ(intSet.size(), 0u);
+  for (int v : {50, 20, 80, 10, 30}) {
+    intSet.insert(v);
+  }
+  EXPECT_EQ(intSet.size(), 5u);
+
+  std::vector<int> out(intSet.size());
+  intSet.parallel_in_order(std::span<int>(out));
+  std::vector<int> expected = {10, 20, 30, 50, 80};
+  EXPECT_EQ(out, expected);
+}
+
+TEST_F(SetTest, ParallelAlgorithmsAndFilter) {
+  for (int v = 1; v <= 10; ++v) {
+    intSet.insert(v);
+  }
+
+  int total = intSet.parallel_reduce(
+      0, [](int v) { return v; }, [](int a, int b) { return a + b; });
+  EXPECT_EQ(total, 55);
+
+  std::atomic<int> count{0};
+  intSet.parallel_for_each([&](int) { ++count; });
+  EXPECT_EQ(count.load(), 10);
+
+  Set<int> odds = intSet.filter([](int v) { return v % 2 == 1; });
+  EXPECT_EQ(odds.size(), 5u);
+  EXPECT_TRUE(odds.search(7));
+  EXPECT_FALSE(odds.search(8));
+  EXPECT_TRUE(intSet.search(8));
+}
+
+TEST_F(SetTest, InsertAndRemoveBatch) {
+  intSet.insert(2);
+  std::vector<int> batch = {5, 1, 4, 2, 3, 5};
+  EXPECT_EQ(intSet.insert_batch(batch), 4u);
+  EXPECT_EQ(intSet.size(), 5u);
+  for (int v = 1; v <= 5; ++v) {
+    EXPECT_TRUE(intSet.search(v));
+  }
+
+  EXPECT_EQ(intSet.remove_batch(std::vector<int>{1, 3, 9}), 2u);
+  EXPECT_FALSE(intSet.search(1));
+  EXPECT_FALSE(intSet.search(3));
+  EXPECT_TRUE(intSet.search(4));
+
+  std::vector<std::string> words = {"b", "a", "c"};
+  EXPECT_EQ(stringSet.insert_batch(words), 3u);
+  EXPECT_TRUE(stringSet.search("a"));
+}
+
+TEST_F(SetTest, TopKAndBottomK) {
+  for (int v : {40, 10, 30, 20, 50}) {
+    intSet.insert(v);
+  }
+  EXPECT_EQ(intSet.top_k(2), std::vector<int>({50, 40}));
+  EXPECT_EQ(intSet.bottom_k(2), std::vector<int>({10, 20}));
+  EXPECT_EQ(intSet.top_k(10).size(), 5u);
+}
+
+TEST_F(SetTest, Sample) {
+  EXPECT_THROW(intSet.sample(), std::out_of_range);
+  for (int v : {1, 2, 3}) {
+    intSet.insert(v);
+  }
+  std::mt19937 gen(7);
+  int v = intSet.sample(gen);
+  EXPECT_TRUE(intSet.search(v));
+  EXPECT_TRUE(intSet.search(intSet.sample()));
+  EXPECT_EQ(intSet.sample(2).size(), 2u);
+  EXPECT_EQ(intSet.sample(5, gen), std::vector<int>({1, 2, 3}));
+}
+
+TEST_F(SetTest, HeterogeneousLookup) {
+  stringSet.insert("hello");
+  stringSet.insert("world");
+  EXPECT_TRUE(stringSet.search(std::string_view("hello")));
+  EXPECT_FALSE(stringSet.search(std::string_view("hell")));
+  EXPECT_TRUE(stringSet.remove(std::string_view("world")));
+  EXPECT_FALSE(stringSet.remove(std::string_view("world")));
+  EXPECT_FALSE(stringSet.search("world"));
+}
+
+TEST_F(SetTest, RemoveLazy) {
+  for (int i = 0; i < 10; ++i) {
+    intSet.insert(i);
+  }
+  EXPECT_TRUE(intSet.remove_lazy(3));
+  EXPECT_FALSE(intSet.remove_lazy(3));
+  EXPECT_FALSE(intSet.search(3));
+  EXPECT_EQ(intSet.size(), 9u);
+  EXPECT_TRUE(intSet.insert(3));
+  EXPECT_TRUE(intSet.remove_lazy(4));
+  intSet.purge();
+  EXPECT_FALSE(intSet.search(4));
+  EXPECT_EQ(intSet.size(), 9u);
+}